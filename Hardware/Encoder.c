@@ -1,6 +1,6 @@
 #include "stm32f10x.h"                  // Device header
 
-int16_t Encoder_Count;
+volatile int16_t Encoder_Count;
 
 void Encoder_Init(void)
 {
@@ -42,8 +42,10 @@ void Encoder_Init(void)
 int16_t Encoder_Get(void)
 {
 	int16_t Temp;
+	__disable_irq();	/* read and clear together, EXTI may count in between */
 	Temp = Encoder_Count;
 	Encoder_Count = 0;
+	__enable_irq();
 	return Temp;
 }
 
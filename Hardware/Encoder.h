@@ -1,6 +1,8 @@
 #ifndef __ENCODER_H
 #define __ENCODER_H
 
+#include <stdint.h>
+
 void Encoder_Init(void);
 int16_t Encoder_Get(void);
 
@@ -1,5 +1,16 @@
 #include "stm32f10x.h"                  // Device header
 #include "Delay.h"
+#include "key_scan.h"
+
+/* scanned keys, bit i of Key_Read() is Key_Pins[i] (active low) */
+static const struct
+{
+	GPIO_TypeDef *port;
+	uint16_t pin;
+} Key_Pins[] = {
+	{GPIOB, GPIO_Pin_1},
+	{GPIOB, GPIO_Pin_11},
+};
 
 void Key_Init(void)
 {
@@ -12,6 +23,7 @@ void Key_Init(void)
 	GPIO_Init(GPIOB, &GPIO_InitStructure);
 }
 
+/* blocking: waits for the key to be released, use key_scan (Key_Tick) in the UI */
 uint8_t Key_GetNum(void)
 {
 	uint8_t KeyNum = 0;
@@ -32,3 +44,27 @@ uint8_t Key_GetNum(void)
 	
 	return KeyNum;
 }
+
+uint32_t Key_Read(void)
+{
+	uint32_t Pressed = 0;
+	for (uint8_t i = 0; i < sizeof(Key_Pins) / sizeof(Key_Pins[0]); i++)
+	{
+		if (GPIO_ReadInputDataBit(Key_Pins[i].port, Key_Pins[i].pin) == 0)
+		{
+			Pressed |= 1u << i;
+		}
+	}
+	return Pressed;
+}
+
+/* called from SysTick_Handler every 1 ms, samples the keys every KEY_SCAN_PERIOD_MS */
+void Key_Tick(void)
+{
+	static uint8_t Count;
+	if (++Count >= KEY_SCAN_PERIOD_MS)
+	{
+		Count = 0;
+		key_scan_update(Key_Read());
+	}
+}
@@ -3,5 +3,7 @@
 
 void Key_Init(void);
 uint8_t Key_GetNum(void);
+uint32_t Key_Read(void);
+void Key_Tick(void);
 
 #endif
@@ -175,6 +175,101 @@
 #define U8G2_BALANCED_STR_WIDTH_CALCULATION
 #endif
 
+/*
+  Dirty tile tracking for full buffer mode.
+  The low level draw procedure (u8g2_ll_hvline_vertical_top_lsb) marks every
+  8x8 tile it touches in a small bitmap. u8g2_SendDirtyBuffer() will then only
+  transfer those tiles, which had been drawn in the current or in the previous 
+  frame. This reduces the number of bytes on a slow bus (I2C) for mostly empty screens.
+  U8G2_DIRTY_MAX_TILES is the max number of tiles of the display (128x64: 16*8 = 128).
+  Displays with more tiles will fall back to a full u8g2_SendBuffer().
+*/
+#ifndef U8G2_WITHOUT_DIRTY_TILES
+#define U8G2_WITH_DIRTY_TILES
+#endif
+
+#ifndef U8G2_DIRTY_MAX_TILES
+#define U8G2_DIRTY_MAX_TILES 128
+#endif
+
+/*
+  The following macro enables a RAM index for the most recently used fonts.
+  For each of the U8G2_FONT_INDEX_SLOTS fonts, the index stores the decoded
+  font header and, for the encodings U8G2_FONT_INDEX_FIRST..U8G2_FONT_INDEX_LAST,
+  the offset of the glyph data and the delta x of the glyph. u8g2_SetFont() 
+  copies the header from the index instead of parsing it again and the glyph
+  lookup/string width calculation do not scan the glyph list any more.
+  The index for a font is built when the font is set and not in the index.
+  RAM: U8G2_FONT_INDEX_SLOTS * (3*(U8G2_FONT_INDEX_LAST-U8G2_FONT_INDEX_FIRST+1) + 32) bytes
+*/
+#ifndef U8G2_WITHOUT_FONT_INDEX
+#define U8G2_WITH_FONT_INDEX
+#endif
+
+#ifndef U8G2_FONT_INDEX_SLOTS
+#define U8G2_FONT_INDEX_SLOTS 4
+#endif
+#define U8G2_FONT_INDEX_FIRST 32
+#define U8G2_FONT_INDEX_LAST 126
+
+/*
+  The following macro enables a LRU cache of decoded glyphs. A glyph is 
+  decoded once into vertical bytes (same layout as the SSD1306 page memory)
+  and stored in an arena of U8G2_GLYPH_CACHE_SIZE bytes, the key is font and 
+  encoding. Later calls to u8g2_DrawGlyph()/u8g2_DrawStr() copy the glyph into 
+  the tile buffer with shift and mask operations instead of decoding the RLE 
+  data into single hv lines. Draw color, font mode, user clip window and the 
+  dirty tile marks are the same as for the decoded glyph.
+  The cache is used for U8G2_R0 with the vertical_top_lsb buffer layout
+  (SSD1306 and similar) and font direction 0. Other setups and glyphs larger
+  than U8G2_GLYPH_CACHE_MAX_GLYPH bytes use the normal decode procedure.
+  Use u8g2_GetGlyphCacheStat() to size the arena for the fonts of the application.
+  RAM: U8G2_GLYPH_CACHE_SIZE + U8G2_GLYPH_CACHE_ENTRIES * 20 bytes (32 bit target)
+*/
+#ifndef U8G2_WITHOUT_GLYPH_CACHE
+#define U8G2_WITH_GLYPH_CACHE
+#endif
+
+#ifndef U8G2_GLYPH_CACHE_SIZE
+#define U8G2_GLYPH_CACHE_SIZE 768
+#endif
+#ifndef U8G2_GLYPH_CACHE_ENTRIES
+#define U8G2_GLYPH_CACHE_ENTRIES 64
+#endif
+#ifndef U8G2_GLYPH_CACHE_MAX_GLYPH
+#define U8G2_GLYPH_CACHE_MAX_GLYPH (U8G2_GLYPH_CACHE_SIZE/4)
+#endif
+
+/*
+  The following macro enables a tile native blitter for u8g2_DrawXBM().
+  Blocks of 8x8 pixels of the XBM bitmap (horizontal bytes, lsb left) are
+  transposed with 32 bit word operations into vertical bytes and written into
+  the tile buffer with shift and mask operations instead of one hv line per
+  run of pixels. Draw color, bitmap mode, user clip window and the dirty tile
+  marks are the same as for the hv line procedure.
+  Like the glyph cache, the blitter is used for U8G2_R0 with the 
+  vertical_top_lsb buffer layout, other setups use the hv line procedure.
+*/
+#ifndef U8G2_WITHOUT_XBM_BLIT
+#define U8G2_WITH_XBM_BLIT
+#endif
+
+/*
+  The following macro enables box fills directly in the tile buffer.
+  u8g2_DrawBox(), u8g2_DrawFrame() and u8g2_DrawRBox() compute the masks of
+  the top and bottom page of a span once and write whole bytes of the
+  tile buffer instead of one hv line per row or column. The rounded corners
+  of u8g2_DrawRBox() are taken from precomputed tables for radius up to 
+  U8G2_RBOX_MAX_TABLE_RADIUS, the result is the same as u8g2_DrawDisc().
+  Used for U8G2_R0 with the vertical_top_lsb buffer layout, other setups
+  use the hv line procedure. u8g2_DrawRBox() with XOR draw color or larger
+  radius also uses the hv line procedure.
+*/
+#ifndef U8G2_WITHOUT_BOX_FILL
+#define U8G2_WITH_BOX_FILL
+#endif
+#define U8G2_RBOX_MAX_TABLE_RADIUS 7
+
 
 /*==========================================*/
 
@@ -289,6 +384,10 @@ struct _u8g2_font_decode_t
 };
 typedef struct _u8g2_font_decode_t u8g2_font_decode_t;
 
+#ifdef U8G2_WITH_FONT_INDEX
+typedef struct _u8g2_font_index_t u8g2_font_index_t;
+#endif
+
 struct _u8g2_kerning_t
 {
   uint16_t first_table_cnt;
@@ -363,6 +462,9 @@ struct u8g2_struct
   u8g2_font_calc_vref_fnptr font_calc_vref;
   u8g2_font_decode_t font_decode;		/* new font decode structure */
   u8g2_font_info_t font_info;			/* new font info structure */
+#ifdef U8G2_WITH_FONT_INDEX
+  u8g2_font_index_t *font_index;		/* index of the current font, valid if font_index->font == font */
+#endif
 
 #ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
   /* 1 of there is an intersection between user_?? and clip_?? box */
@@ -382,6 +484,12 @@ struct u8g2_struct
 					
 	// the following variable should be renamed to is_buffer_auto_clear
   uint8_t is_auto_page_clear; 		/* set to 0 to disable automatic clear of the buffer in firstPage() and nextPage() */
+
+#ifdef U8G2_WITH_DIRTY_TILES
+  /* one bit per tile, bit index is tile_y*tile_width+tile_x */
+  uint8_t tile_dirty[(U8G2_DIRTY_MAX_TILES+7)/8];	/* tiles touched since the last u8g2_ClearBuffer() */
+  uint8_t tile_shown[(U8G2_DIRTY_MAX_TILES+7)/8];	/* tiles which might be non-empty on the display */
+#endif /* U8G2_WITH_DIRTY_TILES */
   
 };
 
@@ -407,6 +515,9 @@ struct u8g2_struct
 #define u8g2_SetPowerSave(u8g2, is_enable) u8x8_SetPowerSave(u8g2_GetU8x8(u8g2), (is_enable))
 #define u8g2_SetFlipMode(u8g2, mode) u8x8_SetFlipMode(u8g2_GetU8x8(u8g2), (mode))
 #define u8g2_SetContrast(u8g2, value) u8x8_SetContrast(u8g2_GetU8x8(u8g2), (value))
+#ifdef U8X8_WITH_SHADOW_DIFF
+#define u8g2_SetShadowBuffer(u8g2, buf) u8x8_SetShadowBuffer(u8g2_GetU8x8(u8g2), (buf))
+#endif
 //#define u8g2_ClearDisplay(u8g2) u8x8_ClearDisplay(u8g2_GetU8x8(u8g2))  obsolete, can not be used in all cases
 void u8g2_ClearDisplay(u8g2_t *u8g2);
 
@@ -726,6 +837,7 @@ void u8g2_Setup_ssd1306_i2c_128x64_noname_2(u8g2_t *u8g2, const u8g2_cb_t *rotat
 void u8g2_Setup_ssd1306_i2c_128x64_vcomh0_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1306_i2c_128x64_alt0_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1306_i2c_128x64_noname_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1306_i2c_128x64_stream_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1306_i2c_128x64_vcomh0_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1306_i2c_128x64_alt0_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1312_128x64_noname_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
@@ -1770,6 +1882,17 @@ uint8_t u8g2_NextPage(u8g2_t *u8g2);
 void u8g2_UpdateDisplayArea(u8g2_t *u8g2, uint8_t  tx, uint8_t ty, uint8_t tw, uint8_t th);
 void u8g2_UpdateDisplay(u8g2_t *u8g2);
 
+#ifdef U8G2_WITH_DIRTY_TILES
+/* x, y, w, h are pixel positions within the buffer (not the display) */
+void u8g2_MarkDirtyBox(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+void u8g2_MarkAllDirty(u8g2_t *u8g2);
+void u8g2_SendDirtyBuffer(u8g2_t *u8g2);
+#else
+#define u8g2_MarkDirtyBox(u8g2, x, y, w, h)
+#define u8g2_MarkAllDirty(u8g2)
+#define u8g2_SendDirtyBuffer(u8g2) u8g2_SendBuffer(u8g2)
+#endif /* U8G2_WITH_DIRTY_TILES */
+
 void u8g2_WriteBufferPBM(u8g2_t *u8g2, void (*out)(const char *s));
 void u8g2_WriteBufferXBM(u8g2_t *u8g2, void (*out)(const char *s));
 /* SH1122, LD7032, ST7920, ST7986, LC7981, T6963, SED1330, RA8835, MAX7219, LS0 */ 
@@ -1959,6 +2082,22 @@ void u8g2_SetFontRefHeightAll(u8g2_t *u8g2);
 
 void u8g2_DrawHB(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const unsigned char *data);
 
+#ifdef U8G2_WITH_GLYPH_CACHE
+/* the glyph cache is shared by all u8g2 objects */
+typedef struct
+{
+  uint32_t hit;		/* glyph found in the cache */
+  uint32_t miss;	/* glyph decoded into the cache */
+  uint32_t evict;	/* glyphs removed to get space for a new glyph */
+  uint32_t bypass;	/* glyph too large for the cache, decoded directly */
+  uint16_t used;	/* used bytes of the arena */
+  uint8_t glyphs;	/* number of glyphs in the cache */
+} u8g2_glyph_cache_stat_t;
+
+void u8g2_GetGlyphCacheStat(u8g2_glyph_cache_stat_t *stat);
+void u8g2_ClearGlyphCache(void);	/* remove all glyphs and reset the counters */
+#endif /* U8G2_WITH_GLYPH_CACHE */
+
 
 /*==========================================*/
 /* u8log_u8g2.c */
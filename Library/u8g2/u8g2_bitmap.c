@@ -164,6 +164,188 @@ void u8g2_DrawHXBM(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len,
 }
 
 
+#ifdef U8G2_WITH_XBM_BLIT
+
+/* position of a bitmap which may start left of/above the display (negative position wrapped around) */
+static int32_t u8g2_xbm_signed_pos(u8g2_uint_t pos, u8g2_uint_t len)
+{
+  if ( (u8g2_uint_t)(pos + len) < pos )
+    return (int32_t)pos - (int32_t)(u8g2_uint_t)~(u8g2_uint_t)0 - 1;
+  return pos;
+}
+
+/*
+  Transpose a 8x8 bit matrix. 
+  Input: lo and hi contain the XBM rows 0..3 and 4..7, one byte per row, lsb is the left pixel.
+  Output: lo and hi contain the columns 0..3 and 4..7, one byte per column, lsb is the top pixel.
+*/
+static void u8g2_xbm_transpose(uint32_t *lo, uint32_t *hi)
+{
+  uint32_t x = *lo, y = *hi, t;
+  
+  /* swap the 2x2, 4x4 and finally the 8x8 sub blocks */
+  t = (x ^ (x >> 7)) & 0x00AA00AAUL;
+  x ^= t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00AA00AAUL;
+  y ^= t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000CCCCUL;
+  x ^= t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000CCCCUL;
+  y ^= t ^ (t << 14);
+  t = (x & 0x0F0F0F0FUL) | ((y & 0x0F0F0F0FUL) << 4);
+  y = ((x >> 4) & 0x0F0F0F0FUL) | (y & 0xF0F0F0F0UL);
+  *lo = t;
+  *hi = y;
+}
+
+/* mark the tile of pixel (x, page*8) once per run of calls with the same tile */
+static void u8g2_xbm_mark_tile(u8g2_t *u8g2, int32_t x, int32_t page, uint16_t *last)
+{
+  uint16_t tile = (uint16_t)(page*32 + (x >> 3) + 1);
+  if ( *last == tile )
+    return;
+  *last = tile;
+  u8g2_MarkDirtyBox(u8g2, x, page*8, 1, 1);
+}
+
+/*
+  Description:
+    Copy a XBM bitmap into the tile buffer, 8x8 pixel blocks at a time.
+  Uses the draw color for the set pixels. If the bitmap mode is solid, 
+  the other pixels are drawn with the inverted color.
+*/
+static void u8g2_xbm_blit(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap)
+{
+  uint8_t *buf;
+  const uint8_t *src;
+  int32_t gx, gy, x0, x1, y0, y1, r, c, col, dy, page, pages;
+  uint32_t lo, hi;
+  uint16_t blen, dirty_lo, dirty_hi;
+  uint8_t i, s, m, v, f, b, d, is_solid;
+  uint8_t fg_or, fg_xor, bg_or, bg_xor;
+  
+#ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
+  if ( u8g2->is_page_clip_window_intersection == 0 )
+    return;
+#endif /* U8G2_WITH_CLIP_WINDOW_SUPPORT */
+
+  /* clip the bitmap against the user window */
+  gx = u8g2_xbm_signed_pos(x, w);
+  gy = u8g2_xbm_signed_pos(y, h);
+  x0 = gx;
+  x1 = gx + w;
+  y0 = gy;
+  y1 = gy + h;
+  if ( x0 < (int32_t)u8g2->user_x0 )
+    x0 = u8g2->user_x0;
+  if ( x1 > (int32_t)u8g2->user_x1 )
+    x1 = u8g2->user_x1;
+  if ( y0 < (int32_t)u8g2->user_y0 )
+    y0 = u8g2->user_y0;
+  if ( y1 > (int32_t)u8g2->user_y1 )
+    y1 = u8g2->user_y1;
+  if ( x0 >= x1 || y0 >= y1 )
+    return;
+  
+  /* same operations as the low level hvline procedure: pixel |= or_mask; pixel ^= xor_mask */
+  fg_or = u8g2->draw_color <= 1 ? 0xff : 0;
+  fg_xor = u8g2->draw_color != 1 ? 0xff : 0;
+  bg_or = 0;
+  bg_xor = 0;
+  is_solid = u8g2->bitmap_transparency == 0;
+  if ( is_solid )
+  {
+    bg_or = 0xff;
+    if ( u8g2->draw_color != 0 )
+      bg_xor = 0xff;	/* background color is 0 */
+    /* all pixels of the clipped box are drawn */
+    u8g2_MarkDirtyBox(u8g2, x0, y0 - u8g2->pixel_curr_row, x1 - x0, y1 - y0);
+  }
+  
+  blen = (w + 7) >> 3;
+  pages = u8g2->tile_buf_height;
+  dirty_lo = 0;
+  dirty_hi = 0;
+  
+  /* r: first bitmap row of a band of 8 rows, the band starts at buffer row dy */
+  for( r = (y0 - gy) & ~7; r < y1 - gy; r += 8 )
+  {
+    /* rows of the band within the clip window */
+    m = 0xff;
+    if ( gy + r < y0 )
+      m <<= y0 - gy - r;
+    if ( gy + r + 8 > y1 )
+      m &= 0xff >> (gy + r + 8 - y1);
+    
+    dy = gy + r - u8g2->pixel_curr_row;
+    page = (dy + 8) / 8 - 1;		/* dy >= -7 */
+    s = (uint8_t)((dy + 8) & 7);
+    
+    for( c = (x0 - gx) & ~7; c < x1 - gx; c += 8 )
+    {
+      /* collect the 8 rows of the block, rows outside of the band mask are not read */
+      src = bitmap + r*blen + (c >> 3);
+      lo = 0;
+      hi = 0;
+      for( i = 0; i < 8; i++ )
+      {
+	if ( m & (1 << i) )
+	{
+	  if ( i < 4 )
+	    lo |= (uint32_t)*src << (i*8);
+	  else
+	    hi |= (uint32_t)*src << ((i-4)*8);
+	}
+	src += blen;
+      }
+      u8g2_xbm_transpose(&lo, &hi);
+      
+      for( i = 0; i < 8; i++ )
+      {
+	col = gx + c + i;
+	if ( col < x0 || col >= x1 )
+	  continue;
+	v = (uint8_t)(i < 4 ? lo >> (i*8) : hi >> ((i-4)*8));
+	f = v & m;
+	b = (uint8_t)(~v & m);
+	
+	/* upper part of the band */
+	if ( page >= 0 )
+	{
+	  buf = u8g2->tile_buf_ptr + page*u8g2->pixel_buf_width + col;
+	  v = (uint8_t)(f << s);
+	  d = *buf;
+	  d |= v & fg_or;
+	  d ^= v & fg_xor;
+	  if ( !is_solid && v != 0 )
+	    u8g2_xbm_mark_tile(u8g2, col, page, &dirty_lo);
+	  v = (uint8_t)(b << s);
+	  d |= v & bg_or;
+	  d ^= v & bg_xor;
+	  *buf = d;
+	}
+	/* lower part of the band in the next page */
+	if ( s != 0 && page + 1 < pages )
+	{
+	  buf = u8g2->tile_buf_ptr + (page+1)*u8g2->pixel_buf_width + col;
+	  v = f >> (8 - s);
+	  d = *buf;
+	  d |= v & fg_or;
+	  d ^= v & fg_xor;
+	  if ( !is_solid && v != 0 )
+	    u8g2_xbm_mark_tile(u8g2, col, page + 1, &dirty_hi);
+	  v = b >> (8 - s);
+	  d |= v & bg_or;
+	  d ^= v & bg_xor;
+	  *buf = d;
+	}
+      }
+    }
+  }
+}
+
+#endif /* U8G2_WITH_XBM_BLIT */
+
 void u8g2_DrawXBM(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap)
 {
   u8g2_uint_t blen;
@@ -175,6 +357,15 @@ void u8g2_DrawXBM(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g
     return;
 #endif /* U8G2_WITH_INTERSECTION */
   
+#ifdef U8G2_WITH_XBM_BLIT
+  /* the blitter only knows the vertical byte layout without rotation */
+  if ( u8g2->cb == U8G2_R0 && u8g2->ll_hvline == u8g2_ll_hvline_vertical_top_lsb )
+  {
+    u8g2_xbm_blit(u8g2, x, y, w, h, bitmap);
+    return;
+  }
+#endif /* U8G2_WITH_XBM_BLIT */
+  
   while( h > 0 )
   {
     u8g2_DrawHXBM(u8g2, x, y, w, bitmap);
@@ -34,6 +34,115 @@
 */
 
 #include "u8g2.h"
+#include <string.h>
+
+#ifdef U8G2_WITH_BOX_FILL
+
+/* position of a box which may start left of/above the display (negative position wrapped around) */
+static int32_t u8g2_box_signed_pos(u8g2_uint_t pos, u8g2_uint_t len)
+{
+  if ( (u8g2_uint_t)(pos + len) < pos )
+    return (int32_t)pos - (int32_t)(u8g2_uint_t)~(u8g2_uint_t)0 - 1;
+  return pos;
+}
+
+/* the box fill only knows the vertical byte layout without rotation */
+static uint8_t u8g2_box_fill_is_usable(u8g2_t *u8g2)
+{
+  if ( u8g2->cb != U8G2_R0 )
+    return 0;
+  if ( u8g2->ll_hvline != u8g2_ll_hvline_vertical_top_lsb )
+    return 0;
+  return 1;
+}
+
+/*
+  Description:
+    Fill the box x0..x1-1, y0..y1-1 in the tile buffer.
+  The masks of the top and bottom page are calculated once, all other pages
+  are written as whole bytes. Result and dirty tile marks are the same as
+  for one hv line per row with the current draw color.
+*/
+static void u8g2_box_fill(u8g2_t *u8g2, int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+  uint8_t *dst;
+  int32_t page;
+  u8g2_uint_t c, n;
+  uint8_t mask;
+  
+#ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
+  if ( u8g2->is_page_clip_window_intersection == 0 )
+    return;
+#endif /* U8G2_WITH_CLIP_WINDOW_SUPPORT */
+
+  /* clip the box against the user window */
+  if ( x0 < (int32_t)u8g2->user_x0 )
+    x0 = u8g2->user_x0;
+  if ( x1 > (int32_t)u8g2->user_x1 )
+    x1 = u8g2->user_x1;
+  if ( y0 < (int32_t)u8g2->user_y0 )
+    y0 = u8g2->user_y0;
+  if ( y1 > (int32_t)u8g2->user_y1 )
+    y1 = u8g2->user_y1;
+  if ( x0 >= x1 || y0 >= y1 )
+    return;
+  
+  /* transform to pixel buffer coordinates */
+  y0 -= u8g2->pixel_curr_row;
+  y1 -= u8g2->pixel_curr_row;
+  n = x1 - x0;
+  u8g2_MarkDirtyBox(u8g2, x0, y0, n, y1 - y0);
+  
+  for( page = y0 >> 3; page*8 < y1; page++ )
+  {
+    mask = 0xff;
+    if ( page*8 < y0 )
+      mask <<= y0 & 7;
+    if ( page*8 + 8 > y1 )
+      mask &= 0xff >> (page*8 + 8 - y1);
+    
+    dst = u8g2->tile_buf_ptr + page*u8g2->pixel_buf_width + x0;
+    if ( mask == 0xff && u8g2->draw_color <= 1 )
+    {
+      memset(dst, u8g2->draw_color != 0 ? 0xff : 0, n);
+    }
+    else if ( u8g2->draw_color == 1 )
+    {
+      for( c = 0; c < n; c++ )
+	dst[c] |= mask;
+    }
+    else if ( u8g2->draw_color == 0 )
+    {
+      mask = ~mask;
+      for( c = 0; c < n; c++ )
+	dst[c] &= mask;
+    }
+    else
+    {
+      for( c = 0; c < n; c++ )
+	dst[c] ^= mask;
+    }
+  }
+}
+
+/*
+  Rounded corners of u8g2_DrawRBox(), same pixels as u8g2_DrawDisc(): 
+  for the radius r, entry k is the number of pixels left out at both ends 
+  of row k, counted from the top (or bottom) row of the box.
+*/
+static const uint8_t u8g2_rbox_inset[] =
+{
+  0,				/* r = 0 */
+  1, 0,				/* r = 1 */
+  1, 0, 0,			/* r = 2 */
+  2, 1, 0, 0,			/* r = 3 */
+  3, 1, 1, 0, 0,		/* r = 4 */
+  3, 2, 1, 0, 0, 0,		/* r = 5 */
+  4, 3, 2, 1, 0, 0, 0,		/* r = 6 */
+  5, 3, 2, 1, 1, 0, 0, 0	/* r = 7 */
+};
+
+#endif /* U8G2_WITH_BOX_FILL */
 
 /*
   draw a filled box
@@ -45,6 +154,15 @@ void u8g2_DrawBox(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g
   if ( u8g2_IsIntersection(u8g2, x, y, x+w, y+h) == 0 ) 
     return;
 #endif /* U8G2_WITH_INTERSECTION */
+#ifdef U8G2_WITH_BOX_FILL
+  if ( u8g2_box_fill_is_usable(u8g2) )
+  {
+    int32_t gx = u8g2_box_signed_pos(x, w);
+    int32_t gy = u8g2_box_signed_pos(y, h);
+    u8g2_box_fill(u8g2, gx, gy, gx + w, gy + h);
+    return;
+  }
+#endif /* U8G2_WITH_BOX_FILL */
   while( h != 0 )
   { 
     u8g2_DrawHVLine(u8g2, x, y, w, 0);
@@ -67,6 +185,26 @@ void u8g2_DrawFrame(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u
     return;
 #endif /* U8G2_WITH_INTERSECTION */
   
+#ifdef U8G2_WITH_BOX_FILL
+  if ( u8g2_box_fill_is_usable(u8g2) )
+  {
+    /* same lines as below, a frame with w = 1 also draws the right line over the left line */
+    int32_t gx = u8g2_box_signed_pos(x, w);
+    int32_t gy = u8g2_box_signed_pos(y, h);
+    u8g2_box_fill(u8g2, gx, gy, gx + w, gy + 1);
+    if ( h >= 2 )
+    {
+      if ( h > 2 )
+      {
+	u8g2_box_fill(u8g2, gx, gy + 1, gx + 1, gy + h - 1);
+	u8g2_box_fill(u8g2, gx + w - 1, gy + 1, gx + w, gy + h - 1);
+      }
+      u8g2_box_fill(u8g2, gx, gy + h - 1, gx + w, gy + h);
+    }
+    return;
+  }
+#endif /* U8G2_WITH_BOX_FILL */
+  
   u8g2_DrawHVLine(u8g2, x, y, w, 0);
   if (h >= 2) {
     h-=2;
@@ -95,6 +233,31 @@ void u8g2_DrawRBox(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8
     return;
 #endif /* U8G2_WITH_INTERSECTION */
 
+#ifdef U8G2_WITH_BOX_FILL
+  /* XOR needs the overlapping discs and boxes below, also boxes smaller than the corners */
+  if ( u8g2_box_fill_is_usable(u8g2) && u8g2->draw_color <= 1 && r <= U8G2_RBOX_MAX_TABLE_RADIUS 
+	&& w >= 2*r+1 && h >= 2*r+1 )
+  {
+    const uint8_t *inset = u8g2_rbox_inset + r*(r+1)/2;
+    int32_t gx = u8g2_box_signed_pos(x, w);
+    int32_t gy = u8g2_box_signed_pos(y, h);
+    uint8_t dc, cut;
+    
+    /* columns of the corners, dc is the distance to the left/right edge */
+    for( dc = 0; dc < inset[0]; dc++ )
+    {
+      /* the first cut rows at the top and bottom are left out */
+      cut = 0;
+      while( inset[cut] > dc )
+	cut++;
+      u8g2_box_fill(u8g2, gx + dc, gy + cut, gx + dc + 1, gy + h - cut);
+      u8g2_box_fill(u8g2, gx + w - 1 - dc, gy + cut, gx + w - dc, gy + h - cut);
+    }
+    u8g2_box_fill(u8g2, gx + inset[0], gy, gx + w - inset[0], gy + h);
+    return;
+  }
+#endif /* U8G2_WITH_BOX_FILL */
+
   xl = x;
   xl += r;
   yu = y;
@@ -44,6 +44,9 @@ void u8g2_ClearBuffer(u8g2_t *u8g2)
   cnt *= u8g2->tile_buf_height;
   cnt *= 8;
   memset(u8g2->tile_buf_ptr, 0, cnt);
+#ifdef U8G2_WITH_DIRTY_TILES
+  memset(u8g2->tile_dirty, 0, sizeof(u8g2->tile_dirty));
+#endif
 }
 
 /*============================================*/
@@ -93,9 +96,116 @@ static void u8g2_send_buffer(u8g2_t *u8g2)
 void u8g2_SendBuffer(u8g2_t *u8g2)
 {
   u8g2_send_buffer(u8g2);
+#ifdef U8G2_WITH_DIRTY_TILES
+  /* the display now contains the buffer: only drawn tiles can be non-empty */
+  memcpy(u8g2->tile_shown, u8g2->tile_dirty, sizeof(u8g2->tile_shown));
+#endif
   u8x8_RefreshDisplay( u8g2_GetU8x8(u8g2) );  
 }
 
+/*============================================*/
+#ifdef U8G2_WITH_DIRTY_TILES
+
+/*
+  Description:
+    Mark all tiles, which intersect with the given pixel box, as dirty.
+    Called by the low level draw procedures. Procedures which write directly 
+    into the buffer must call this to keep u8g2_SendDirtyBuffer() in sync.
+  Args:
+    x, y, w, h: Pixel box within the local buffer (not the display!), w and h must not be 0
+*/
+void u8g2_MarkDirtyBox(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  uint16_t idx;
+  uint8_t tile_width;
+  uint8_t tx, tx0, tx1, ty, ty1;
+  
+  tile_width = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  tx0 = x >> 3;
+  tx1 = (x + w - 1) >> 3;
+  if ( tx1 >= tile_width )
+    tx1 = tile_width - 1;
+  ty = (y >> 3) + u8g2->tile_curr_row;
+  ty1 = ((y + h - 1) >> 3) + u8g2->tile_curr_row;
+  
+  for( ; ty <= ty1; ty++ )
+  {
+    idx = ty;
+    idx *= tile_width;
+    idx += tx0;
+    for( tx = tx0; tx <= tx1; tx++ )
+    {
+      if ( idx >= U8G2_DIRTY_MAX_TILES )
+	return;
+      u8g2->tile_dirty[idx >> 3] |= (uint8_t)(1 << (idx & 7));
+      idx++;
+    }
+  }
+}
+
+void u8g2_MarkAllDirty(u8g2_t *u8g2)
+{
+  memset(u8g2->tile_dirty, 0xff, sizeof(u8g2->tile_dirty));
+}
+
+/*
+  Description:
+    Same as u8g2_SendBuffer(), but only transfer tiles which have been drawn 
+    since the last u8g2_ClearBuffer() or which had been drawn before the 
+    previous send (they need to be cleared on the display).
+    Consecutive tiles within a tile row are sent with one u8x8_DrawTile() call.
+  Limitations:
+    - Only available in full buffer mode (falls back to u8g2_SendBuffer() otherwise)
+    - Displays with more than U8G2_DIRTY_MAX_TILES tiles fall back to u8g2_SendBuffer()
+*/
+void u8g2_SendDirtyBuffer(u8g2_t *u8g2)
+{
+  uint16_t idx;
+  uint8_t tile_width, tile_height;
+  uint8_t tx, ty, start;
+  uint8_t *ptr;
+  
+  tile_width = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  tile_height = u8g2_GetU8x8(u8g2)->display_info->tile_height;
+  
+  if ( u8g2->tile_buf_height != tile_height || (uint16_t)tile_width*tile_height > U8G2_DIRTY_MAX_TILES )
+  {
+    u8g2_SendBuffer(u8g2);
+    return;
+  }
+  
+  /* tile_shown is no longer needed after this loop, so merge the dirty tiles into it */
+  for( idx = 0; idx < sizeof(u8g2->tile_shown); idx++ )
+    u8g2->tile_shown[idx] |= u8g2->tile_dirty[idx];
+  
+  idx = 0;
+  for( ty = 0; ty < tile_height; ty++ )
+  {
+    ptr = u8g2->tile_buf_ptr + (uint16_t)ty*u8g2->pixel_buf_width;
+    tx = 0;
+    while( tx < tile_width )
+    {
+      if ( (u8g2->tile_shown[(idx+tx) >> 3] & (1 << ((idx+tx) & 7))) == 0 )
+      {
+	tx++;
+	continue;
+      }
+      start = tx;
+      do
+      {
+	tx++;
+      } while( tx < tile_width && (u8g2->tile_shown[(idx+tx) >> 3] & (1 << ((idx+tx) & 7))) != 0 );
+      u8x8_DrawTile(u8g2_GetU8x8(u8g2), start, ty, tx-start, ptr + start*8);
+    }
+    idx += tile_width;
+  }
+  
+  memcpy(u8g2->tile_shown, u8g2->tile_dirty, sizeof(u8g2->tile_shown));
+  u8x8_RefreshDisplay( u8g2_GetU8x8(u8g2) );  
+}
+
+#endif /* U8G2_WITH_DIRTY_TILES */
+
 /*============================================*/
 void u8g2_SetBufferCurrTileRow(u8g2_t *u8g2, uint8_t row)
 {
@@ -172,6 +282,11 @@ void u8g2_UpdateDisplayArea(u8g2_t *u8g2, uint8_t  tx, uint8_t ty, uint8_t tw, u
     ty++;
     th--;
   }  
+#ifdef U8G2_WITH_DIRTY_TILES
+  /* drawn tiles inside the area are now visible, keep the superset */
+  for( page_size = 0; page_size < sizeof(u8g2->tile_shown); page_size++ )
+    u8g2->tile_shown[page_size] |= u8g2->tile_dirty[page_size];
+#endif
 }
 
 /* same as sendBuffer, but does not send the ePaper refresh message */
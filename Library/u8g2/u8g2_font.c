@@ -34,6 +34,7 @@
 */
 
 #include "u8g2.h"
+#include <string.h>
 
 /* size of the font data structure, there is no struct or class... */
 /* this is the size for the new font format */
@@ -771,6 +772,102 @@ int8_t u8g2_font_2x_decode_glyph(u8g2_t *u8g2, const uint8_t *glyph_data)
   return d*2;
 }
 
+#ifdef U8G2_WITH_FONT_INDEX
+/*========================================================================*/
+/* font index */
+
+#define U8G2_FONT_INDEX_CNT (U8G2_FONT_INDEX_LAST-U8G2_FONT_INDEX_FIRST+1)
+#define U8G2_FONT_INDEX_ABSENT 0		/* glyph is not part of the font */
+#define U8G2_FONT_INDEX_UNKNOWN 0x0ffff	/* offset does not fit, use the glyph list */
+
+struct _u8g2_font_index_t
+{
+  const uint8_t *font;
+  uint32_t last_use;				/* for the LRU replacement */
+  u8g2_font_info_t font_info;
+  uint16_t glyph_offset[U8G2_FONT_INDEX_CNT];	/* offset of the glyph data from the start of the font */
+  int8_t delta_x[U8G2_FONT_INDEX_CNT];
+};
+
+static u8g2_font_index_t u8g2_font_index[U8G2_FONT_INDEX_SLOTS];
+static uint32_t u8g2_font_index_use_cnt;
+
+/* walk through the glyph list (encodings 0..255) once and store all glyphs of the index range */
+static void u8g2_font_index_build(u8g2_font_index_t *idx)
+{
+  const uint8_t *font = idx->font + U8G2_FONT_DATA_STRUCT_SIZE;
+  u8g2_font_decode_t decode;
+  uint8_t encoding, size;
+  uint32_t offset;
+  
+  memset(idx->glyph_offset, 0, sizeof(idx->glyph_offset));
+  memset(idx->delta_x, 0, sizeof(idx->delta_x));
+  for(;;)
+  {
+    encoding = u8x8_pgm_read( font );
+    size = u8x8_pgm_read( font + 1 );
+    if ( size == 0 )
+      break;
+    if ( encoding >= U8G2_FONT_INDEX_FIRST && encoding <= U8G2_FONT_INDEX_LAST )
+    {
+      offset = (font + 2) - idx->font;
+      if ( offset >= U8G2_FONT_INDEX_UNKNOWN )
+      {
+	idx->glyph_offset[encoding - U8G2_FONT_INDEX_FIRST] = U8G2_FONT_INDEX_UNKNOWN;
+      }
+      else
+      {
+	idx->glyph_offset[encoding - U8G2_FONT_INDEX_FIRST] = offset;
+	/* same field order as in u8g2_GetGlyphWidth() */
+	decode.decode_ptr = font + 2;
+	decode.decode_bit_pos = 0;
+	u8g2_font_decode_get_unsigned_bits(&decode, idx->font_info.bits_per_char_width);
+	u8g2_font_decode_get_unsigned_bits(&decode, idx->font_info.bits_per_char_height);
+	u8g2_font_decode_get_signed_bits(&decode, idx->font_info.bits_per_char_x);
+	u8g2_font_decode_get_signed_bits(&decode, idx->font_info.bits_per_char_y);
+	idx->delta_x[encoding - U8G2_FONT_INDEX_FIRST] = u8g2_font_decode_get_signed_bits(&decode, idx->font_info.bits_per_delta_x);
+      }
+    }
+    font += size;
+  }
+}
+
+/* return the index for the font, build it in the least recently used slot if required */
+static u8g2_font_index_t *u8g2_font_index_get(const uint8_t *font)
+{
+  u8g2_font_index_t *idx = &u8g2_font_index[0];
+  uint8_t i;
+  
+  for( i = 0; i < U8G2_FONT_INDEX_SLOTS; i++ )
+  {
+    if ( u8g2_font_index[i].font == font )
+    {
+      idx = &u8g2_font_index[i];
+      idx->last_use = ++u8g2_font_index_use_cnt;
+      return idx;
+    }
+    if ( u8g2_font_index[i].last_use < idx->last_use )
+      idx = &u8g2_font_index[i];
+  }
+  
+  idx->font = font;
+  idx->last_use = ++u8g2_font_index_use_cnt;
+  u8g2_read_font_info(&(idx->font_info), font);
+  u8g2_font_index_build(idx);
+  return idx;
+}
+
+/* glyph data offset of the current font: 0 absent, 0x0ffff not in the index */
+static uint16_t u8g2_font_index_lookup(u8g2_t *u8g2, uint16_t encoding)
+{
+  if ( encoding < U8G2_FONT_INDEX_FIRST || encoding > U8G2_FONT_INDEX_LAST )
+    return U8G2_FONT_INDEX_UNKNOWN;
+  if ( u8g2->font_index == NULL || u8g2->font_index->font != u8g2->font )
+    return U8G2_FONT_INDEX_UNKNOWN;
+  return u8g2->font_index->glyph_offset[encoding - U8G2_FONT_INDEX_FIRST];
+}
+#endif /* U8G2_WITH_FONT_INDEX */
+
 /*
   Description:
     Find the starting point of the glyph data.
@@ -782,6 +879,13 @@ int8_t u8g2_font_2x_decode_glyph(u8g2_t *u8g2, const uint8_t *glyph_data)
 const uint8_t *u8g2_font_get_glyph_data(u8g2_t *u8g2, uint16_t encoding)
 {
   const uint8_t *font = u8g2->font;
+#ifdef U8G2_WITH_FONT_INDEX
+  uint16_t offset = u8g2_font_index_lookup(u8g2, encoding);
+  if ( offset == U8G2_FONT_INDEX_ABSENT )
+    return NULL;
+  if ( offset != U8G2_FONT_INDEX_UNKNOWN )
+    return font + offset;
+#endif
   font += U8G2_FONT_DATA_STRUCT_SIZE;
 
   
@@ -866,6 +970,375 @@ const uint8_t *u8g2_font_get_glyph_data(u8g2_t *u8g2, uint16_t encoding)
   return NULL;
 }
 
+#ifdef U8G2_WITH_GLYPH_CACHE
+/*========================================================================*/
+/* glyph cache */
+
+#define U8G2_GLYPH_CACHE_HINTS 32	/* size of the lookup hint table, must be a power of 2 */
+
+typedef struct _u8g2_glyph_cache_entry_t
+{
+  const uint8_t *font;
+  uint32_t last_use;			/* for the LRU replacement */
+  uint16_t encoding;
+  uint16_t offset;			/* start of the vertical bytes in the arena */
+  uint8_t width;
+  uint8_t height;
+  int8_t x;				/* x offset of the glyph bitmap */
+  int8_t y;				/* y offset of the glyph bitmap */
+  int8_t delta_x;
+} u8g2_glyph_cache_entry_t;
+
+/* glyph bitmaps: (height+7)/8 rows of width bytes, bit 0 is the upper pixel */
+static uint8_t u8g2_glyph_cache_arena[U8G2_GLYPH_CACHE_SIZE];
+static u8g2_glyph_cache_entry_t u8g2_glyph_cache_entry[U8G2_GLYPH_CACHE_ENTRIES];
+static uint8_t u8g2_glyph_cache_hint[U8G2_GLYPH_CACHE_HINTS];	/* entry found last time for a hash value */
+static uint32_t u8g2_glyph_cache_use_cnt;
+static u8g2_glyph_cache_stat_t u8g2_glyph_cache_stat;
+
+#define u8g2_glyph_cache_hash(font, encoding) \
+  ((uint8_t)(((size_t)(font) >> 2) ^ (encoding)) & (U8G2_GLYPH_CACHE_HINTS-1))
+#define u8g2_glyph_cache_bytes(width, height) ((uint16_t)(width) * (((height)+7) >> 3))
+
+void u8g2_GetGlyphCacheStat(u8g2_glyph_cache_stat_t *stat)
+{
+  *stat = u8g2_glyph_cache_stat;
+}
+
+void u8g2_ClearGlyphCache(void)
+{
+  memset(&u8g2_glyph_cache_stat, 0, sizeof(u8g2_glyph_cache_stat));
+}
+
+/* the cache only knows the vertical byte layout without rotation */
+static uint8_t u8g2_glyph_cache_is_usable(u8g2_t *u8g2)
+{
+  if ( u8g2->cb != U8G2_R0 )
+    return 0;
+  if ( u8g2->ll_hvline != u8g2_ll_hvline_vertical_top_lsb )
+    return 0;
+#ifdef U8G2_WITH_FONT_ROTATION
+  if ( u8g2->font_decode.dir != 0 )
+    return 0;
+#endif
+  return 1;
+}
+
+static u8g2_glyph_cache_entry_t *u8g2_glyph_cache_find(const uint8_t *font, uint16_t encoding)
+{
+  u8g2_glyph_cache_entry_t *e;
+  uint8_t hash = u8g2_glyph_cache_hash(font, encoding);
+  uint8_t i = u8g2_glyph_cache_hint[hash];
+  
+  e = &u8g2_glyph_cache_entry[i];
+  if ( i < u8g2_glyph_cache_stat.glyphs && e->encoding == encoding && e->font == font )
+    return e;
+  for( i = 0; i < u8g2_glyph_cache_stat.glyphs; i++ )
+  {
+    e = &u8g2_glyph_cache_entry[i];
+    if ( e->encoding == encoding && e->font == font )
+    {
+      u8g2_glyph_cache_hint[hash] = i;
+      return e;
+    }
+  }
+  return NULL;
+}
+
+/* remove an entry and close the gap in the arena */
+static void u8g2_glyph_cache_remove(uint8_t i)
+{
+  u8g2_glyph_cache_entry_t *e = &u8g2_glyph_cache_entry[i];
+  uint16_t offset = e->offset;
+  uint16_t size = u8g2_glyph_cache_bytes(e->width, e->height);
+  
+  memmove(u8g2_glyph_cache_arena + offset, u8g2_glyph_cache_arena + offset + size, 
+    u8g2_glyph_cache_stat.used - offset - size);
+  u8g2_glyph_cache_stat.used -= size;
+  u8g2_glyph_cache_stat.glyphs--;
+  
+  /* move the last entry into the free slot, outdated hints are detected by u8g2_glyph_cache_find() */
+  *e = u8g2_glyph_cache_entry[u8g2_glyph_cache_stat.glyphs];
+  for( i = 0; i < u8g2_glyph_cache_stat.glyphs; i++ )
+    if ( u8g2_glyph_cache_entry[i].offset > offset )
+      u8g2_glyph_cache_entry[i].offset -= size;
+}
+
+/* remove least recently used glyphs until a glyph with size bytes fits into the arena */
+static u8g2_glyph_cache_entry_t *u8g2_glyph_cache_alloc(uint16_t size)
+{
+  u8g2_glyph_cache_entry_t *e;
+  uint8_t i, lru;
+  
+  while ( u8g2_glyph_cache_stat.glyphs >= U8G2_GLYPH_CACHE_ENTRIES 
+    || u8g2_glyph_cache_stat.used + size > U8G2_GLYPH_CACHE_SIZE )
+  {
+    lru = 0;
+    for( i = 1; i < u8g2_glyph_cache_stat.glyphs; i++ )
+      if ( u8g2_glyph_cache_entry[i].last_use < u8g2_glyph_cache_entry[lru].last_use )
+	lru = i;
+    u8g2_glyph_cache_remove(lru);
+    u8g2_glyph_cache_stat.evict++;
+  }
+  
+  e = &u8g2_glyph_cache_entry[u8g2_glyph_cache_stat.glyphs++];
+  e->offset = u8g2_glyph_cache_stat.used;
+  u8g2_glyph_cache_stat.used += size;
+  return e;
+}
+
+/* decode the rle data of the glyph (u8g2->font_decode is after the glyph header) into vertical bytes */
+static void u8g2_glyph_cache_decode(u8g2_t *u8g2, uint8_t *buf, uint8_t w, uint8_t h)
+{
+  u8g2_font_decode_t *decode = &(u8g2->font_decode);
+  uint8_t a, b, cnt;
+  uint16_t lx, ly;
+  
+  memset(buf, 0, u8g2_glyph_cache_bytes(w, h));
+  lx = 0;
+  ly = 0;
+  /* same run length sequence as in u8g2_font_decode_glyph() */
+  for(;;)
+  {
+    a = u8g2_font_decode_get_unsigned_bits(decode, u8g2->font_info.bits_per_0);
+    b = u8g2_font_decode_get_unsigned_bits(decode, u8g2->font_info.bits_per_1);
+    do
+    {
+      /* background pixels */
+      lx += a;
+      while ( lx >= w )
+      {
+	lx -= w;
+	ly++;
+      }
+      /* foreground pixels */
+      for( cnt = b; cnt > 0; cnt-- )
+      {
+	if ( ly < h )
+	  buf[(ly >> 3)*w + lx] |= (uint8_t)(1 << (ly & 7));
+	if ( ++lx >= w )
+	{
+	  lx = 0;
+	  ly++;
+	}
+      }
+    } while( u8g2_font_decode_get_unsigned_bits(decode, 1) != 0 );
+    
+    if ( ly >= h )
+      break;
+  }
+}
+
+/* position of a glyph box, which might wrap around at the left or upper edge */
+static int16_t u8g2_glyph_cache_signed_pos(u8g2_uint_t pos, uint8_t len)
+{
+  if ( (u8g2_uint_t)(pos + len) < pos )
+    return (int16_t)((int32_t)pos - (int32_t)(u8g2_uint_t)~(u8g2_uint_t)0 - 1);
+  return (int16_t)pos;
+}
+
+/*
+  Description:
+    Copy a glyph from the arena into the tile buffer.
+  Args:
+    x, y: Upper left corner of the glyph bitmap
+  Uses the draw color for the foreground pixels. If the font mode is solid, 
+  the background pixels of the glyph box are drawn with the inverted color.
+*/
+static void u8g2_glyph_cache_blit(u8g2_t *u8g2, const u8g2_glyph_cache_entry_t *e, u8g2_uint_t x, u8g2_uint_t y)
+{
+  const uint8_t *src = u8g2_glyph_cache_arena + e->offset;
+  const uint8_t *lo, *hi;
+  uint8_t *dst;
+  int16_t gx, gy, x0, x1, y0, y1, k;
+  uint8_t pages, page, mask, ls, hs, v, d, c, n, tile, is_solid;
+  uint8_t fg_or, fg_xor, bg_or, bg_xor;
+  
+#ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
+  if ( u8g2->is_page_clip_window_intersection == 0 )
+    return;
+#endif /* U8G2_WITH_CLIP_WINDOW_SUPPORT */
+
+  /* clip the glyph box against the user window */
+  gx = u8g2_glyph_cache_signed_pos(x, e->width);
+  gy = u8g2_glyph_cache_signed_pos(y, e->height);
+  x0 = gx;
+  x1 = gx + e->width;
+  y0 = gy;
+  y1 = gy + e->height;
+  if ( x0 < (int16_t)u8g2->user_x0 )
+    x0 = u8g2->user_x0;
+  if ( x1 > (int16_t)u8g2->user_x1 )
+    x1 = u8g2->user_x1;
+  if ( y0 < (int16_t)u8g2->user_y0 )
+    y0 = u8g2->user_y0;
+  if ( y1 > (int16_t)u8g2->user_y1 )
+    y1 = u8g2->user_y1;
+  if ( x0 >= x1 || y0 >= y1 )
+    return;
+  
+  /* transform to pixel buffer coordinates */
+  gy -= u8g2->pixel_curr_row;
+  y0 -= u8g2->pixel_curr_row;
+  y1 -= u8g2->pixel_curr_row;
+  n = x1 - x0;
+  src += x0 - gx;
+  
+  /* same operations as the low level hvline procedure: pixel |= or_mask; pixel ^= xor_mask */
+  fg_or = u8g2->draw_color <= 1 ? 0xff : 0;
+  fg_xor = u8g2->draw_color != 1 ? 0xff : 0;
+  bg_or = 0;
+  bg_xor = 0;
+  is_solid = u8g2->font_decode.is_transparent == 0;
+  if ( is_solid )
+  {
+    bg_or = 0xff;
+    if ( u8g2->draw_color != 0 )
+      bg_xor = 0xff;	/* background color is 0 */
+    /* all pixels of the clipped box are drawn */
+    u8g2_MarkDirtyBox(u8g2, x0, y0, n, y1 - y0);
+  }
+  
+  pages = (e->height + 7) >> 3;
+  for( page = y0 >> 3; (int16_t)page*8 < y1; page++ )
+  {
+    /* rows of the clipped glyph box within this page */
+    mask = 0xff;
+    if ( (int16_t)page*8 < y0 )
+      mask <<= y0 & 7;
+    if ( (int16_t)page*8 + 8 > y1 )
+      mask &= 0xff >> (page*8 + 8 - y1);
+    
+    /* glyph row at bit 0 of this page: combine two glyph bytes */
+    k = (int16_t)page*8 - gy;
+    if ( k < 0 )
+    {
+      lo = NULL;
+      ls = 0;
+      hi = src;
+      hs = -k;
+    }
+    else
+    {
+      lo = src + (k >> 3)*e->width;
+      ls = k & 7;
+      hi = NULL;
+      hs = 8 - ls;
+      if ( ls != 0 && (k >> 3) + 1 < pages )
+	hi = lo + e->width;
+    }
+    
+    dst = u8g2->tile_buf_ptr + page*u8g2->pixel_buf_width + x0;
+    tile = 0xff;
+    for( c = 0; c < n; c++ )
+    {
+      v = 0;
+      if ( lo != NULL )
+	v = lo[c] >> ls;
+      if ( hi != NULL )
+	v |= (uint8_t)(hi[c] << hs);
+      v &= mask;
+      /* transparent mode: only tiles with foreground pixels are drawn, as in u8g2_font_decode_len() */
+      if ( is_solid == 0 && v != 0 && tile != ((x0 + c) >> 3) )
+      {
+	tile = (x0 + c) >> 3;
+	u8g2_MarkDirtyBox(u8g2, x0 + c, page*8, 1, 1);
+      }
+      d = dst[c];
+      d |= v & fg_or;
+      d ^= v & fg_xor;
+      v ^= mask;	/* background pixels */
+      d |= v & bg_or;
+      d ^= v & bg_xor;
+      dst[c] = d;
+    }
+  }
+}
+
+/* draw a glyph at u8g2->font_decode.target_x/y, decode it into the cache if required */
+static u8g2_uint_t u8g2_glyph_cache_draw_glyph(u8g2_t *u8g2, uint16_t encoding)
+{
+  u8g2_font_decode_t *decode = &(u8g2->font_decode);
+  u8g2_glyph_cache_entry_t *e;
+  const uint8_t *glyph_data;
+  uint8_t w, h;
+  int8_t x, y, d;
+  uint16_t size;
+  
+  e = u8g2_glyph_cache_find(u8g2->font, encoding);
+  if ( e != NULL )
+  {
+    u8g2_glyph_cache_stat.hit++;
+    w = e->width;
+    h = e->height;
+    x = e->x;
+    y = e->y;
+    d = e->delta_x;
+  }
+  else
+  {
+    glyph_data = u8g2_font_get_glyph_data(u8g2, encoding);
+    if ( glyph_data == NULL )
+      return 0;
+    
+    /* same header as in u8g2_font_decode_glyph() */
+    u8g2_font_setup_decode(u8g2, glyph_data);
+    w = decode->glyph_width;
+    h = decode->glyph_height;
+    x = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_char_x);
+    y = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_char_y);
+    d = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_delta_x);
+    
+    size = u8g2_glyph_cache_bytes(w, h);
+    if ( size > U8G2_GLYPH_CACHE_MAX_GLYPH )
+    {
+      u8g2_glyph_cache_stat.bypass++;
+      return u8g2_font_decode_glyph(u8g2, glyph_data);
+    }
+    
+#ifdef U8G2_WITH_INTERSECTION
+    /* do not fill the cache with glyphs outside of the visible area */
+    if ( w > 0 )
+    {
+      u8g2_uint_t x0 = decode->target_x + x;
+      u8g2_uint_t y0 = decode->target_y - (h + y);
+      if ( u8g2_IsIntersection(u8g2, x0, y0, x0 + w, y0 + h) == 0 ) 
+	return d;
+    }
+#endif /* U8G2_WITH_INTERSECTION */
+    
+    u8g2_glyph_cache_stat.miss++;
+    e = u8g2_glyph_cache_alloc(size);
+    e->font = u8g2->font;
+    e->encoding = encoding;
+    e->width = w;
+    e->height = h;
+    e->x = x;
+    e->y = y;
+    e->delta_x = d;
+    if ( w > 0 )
+      u8g2_glyph_cache_decode(u8g2, u8g2_glyph_cache_arena + e->offset, w, h);
+  }
+  e->last_use = ++u8g2_glyph_cache_use_cnt;
+  
+  /* side effects of u8g2_font_decode_glyph() */
+  decode->glyph_width = w;
+  decode->glyph_height = h;
+  if ( w > 0 )
+  {
+    decode->target_x += x;
+    decode->target_y -= h + y;
+#ifdef U8G2_WITH_INTERSECTION
+    if ( u8g2_IsIntersection(u8g2, decode->target_x, decode->target_y, 
+	decode->target_x + w, decode->target_y + h) == 0 ) 
+      return d;
+#endif /* U8G2_WITH_INTERSECTION */
+    u8g2_glyph_cache_blit(u8g2, e, decode->target_x, decode->target_y);
+  }
+  return d;
+}
+#endif /* U8G2_WITH_GLYPH_CACHE */
+
 static u8g2_uint_t u8g2_font_draw_glyph(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint16_t encoding)
 {
   u8g2_uint_t dx = 0;
@@ -873,6 +1346,10 @@ static u8g2_uint_t u8g2_font_draw_glyph(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t
   u8g2->font_decode.target_y = y;
   //u8g2->font_decode.is_transparent = is_transparent; this is already set
   //u8g2->font_decode.dir = dir;
+#ifdef U8G2_WITH_GLYPH_CACHE
+  if ( u8g2_glyph_cache_is_usable(u8g2) )
+    return u8g2_glyph_cache_draw_glyph(u8g2, encoding);
+#endif
   const uint8_t *glyph_data = u8g2_font_get_glyph_data(u8g2, encoding);
   if ( glyph_data != NULL )
   {
@@ -1285,7 +1762,12 @@ void u8g2_SetFont(u8g2_t *u8g2, const uint8_t  *font)
 //	u8g2->last_unicode = 0x0ffff;
 //#endif 
     u8g2->font = font;
+#ifdef U8G2_WITH_FONT_INDEX
+    u8g2->font_index = u8g2_font_index_get(font);
+    u8g2->font_info = u8g2->font_index->font_info;
+#else
     u8g2_read_font_info(&(u8g2->font_info), font);
+#endif
     u8g2_UpdateRefHeight(u8g2);
     /* u8g2_SetFontPosBaseline(u8g2); */ /* removed with issue 195 */
   }
@@ -1329,6 +1811,10 @@ static u8g2_uint_t u8g2_string_width(u8g2_t *u8g2, const char *str)
 #ifdef U8G2_BALANCED_STR_WIDTH_CALCULATION
   int8_t initial_x_offset = -64;
 #endif 
+#if defined(U8G2_WITH_FONT_INDEX) && !defined(U8G2_BALANCED_STR_WIDTH_CALCULATION)
+  uint16_t offset;
+  uint16_t pending_e = 0x0ffff;	/* last glyph taken from the index, side effects not yet applied */
+#endif
   
   u8g2->font_decode.glyph_width = 0;
   u8x8_utf8_init(u8g2_GetU8x8(u8g2));
@@ -1347,6 +1833,26 @@ static u8g2_uint_t u8g2_string_width(u8g2_t *u8g2, const char *str)
     str++;
     if ( e != 0x0fffe )
     {
+#if defined(U8G2_WITH_FONT_INDEX) && !defined(U8G2_BALANCED_STR_WIDTH_CALCULATION)
+      /* the x offset and width are only required for the last glyph, take delta x from the index */
+      offset = u8g2_font_index_lookup(u8g2, e);
+      if ( offset != U8G2_FONT_INDEX_UNKNOWN )
+      {
+	dx = 0;
+	if ( offset != U8G2_FONT_INDEX_ABSENT )
+	{
+	  dx = u8g2->font_index->delta_x[e - U8G2_FONT_INDEX_FIRST];
+	  pending_e = e;
+	}
+	w += dx;
+	continue;
+      }
+      if ( pending_e != 0x0ffff )
+      {
+	u8g2_GetGlyphWidth(u8g2, pending_e);
+	pending_e = 0x0ffff;
+      }
+#endif
       dx = u8g2_GetGlyphWidth(u8g2, e);		/* delta x value of the glyph, side effect: updates u8g2->glyph_x_offset */
 #ifdef U8G2_BALANCED_STR_WIDTH_CALCULATION
       if ( initial_x_offset == -64 )
@@ -1358,6 +1864,11 @@ static u8g2_uint_t u8g2_string_width(u8g2_t *u8g2, const char *str)
   }
   //printf("\n");
   
+#if defined(U8G2_WITH_FONT_INDEX) && !defined(U8G2_BALANCED_STR_WIDTH_CALCULATION)
+  if ( pending_e != 0x0ffff )
+    u8g2_GetGlyphWidth(u8g2, pending_e);	/* side effect: glyph width and x offset of the last glyph */
+#endif
+  
   /* adjust the last glyph, check for issue #16: do not adjust if width is 0 */
   if ( u8g2->font_decode.glyph_width != 0 )
   {
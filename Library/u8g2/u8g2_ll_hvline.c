@@ -76,7 +76,7 @@ void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
   uint8_t bit_pos, mask;
   uint8_t or_mask, xor_mask;
 #ifdef __unix
-  uint8_t *max_ptr = u8g2->tile_buf_ptr + u8g2_GetU8x8(u8g2)->display_info->tile_width*u8g2->tile_buf_height*8;
+  uint8_t *max_ptr = u8g2->tile_buf_ptr + u8g2->pixel_buf_width*u8g2->tile_buf_height;
 #endif
 
   //assert(x >= u8g2->buf_x0);
@@ -99,12 +99,19 @@ void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
 
 
   offset = y;		/* y might be 8 or 16 bit, but we need 16 bit, so use a 16 bit variable */
-  offset &= ~7;
-  offset *= u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  offset >>= 3;
+  offset *= u8g2->pixel_buf_width;	/* equal to tile_width*8 for the display buffer, also valid for offscreen buffers */
   ptr = u8g2->tile_buf_ptr;
   ptr += offset;
   ptr += x;
   
+#ifdef U8G2_WITH_DIRTY_TILES
+  if ( dir == 0 )
+    u8g2_MarkDirtyBox(u8g2, x, y, len, 1);
+  else
+    u8g2_MarkDirtyBox(u8g2, x, y, 1, len);
+#endif
+  
   if ( dir == 0 )
   {
       do
@@ -176,8 +183,8 @@ static void u8g2_draw_pixel_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_u
   mask <<= bit_pos;
 
   offset = y;		/* y might be 8 or 16 bit, but we need 16 bit, so use a 16 bit variable */
-  offset &= ~7;
-  offset *= u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  offset >>= 3;
+  offset *= u8g2->pixel_buf_width;	/* equal to tile_width*8 for the display buffer, also valid for offscreen buffers */
   ptr = u8g2->tile_buf_ptr;
   ptr += offset;
   ptr += x;
@@ -200,6 +207,12 @@ static void u8g2_draw_pixel_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_u
 */
 void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
 {
+#ifdef U8G2_WITH_DIRTY_TILES
+  if ( dir == 0 )
+    u8g2_MarkDirtyBox(u8g2, x, y, len, 1);
+  else
+    u8g2_MarkDirtyBox(u8g2, x, y, 1, len);
+#endif
   if ( dir == 0 )
   {
     do
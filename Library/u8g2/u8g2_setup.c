@@ -71,6 +71,9 @@ void u8g2_SetClipWindow(u8g2_t *u8g2, u8g2_uint_t clip_x0, u8g2_uint_t clip_y0,
 void u8g2_SetupBuffer(u8g2_t *u8g2, uint8_t *buf, uint8_t tile_buf_height, u8g2_draw_ll_hvline_cb ll_hvline_cb, const u8g2_cb_t *u8g2_cb)
 {
   u8g2->font = NULL;
+#ifdef U8G2_WITH_FONT_INDEX
+  u8g2->font_index = NULL;
+#endif
   //u8g2->kerning = NULL;
   //u8g2->get_kerning_cb = u8g2_GetNullKerning;
   
@@ -89,6 +92,12 @@ void u8g2_SetupBuffer(u8g2_t *u8g2, uint8_t *buf, uint8_t tile_buf_height, u8g2_
   u8g2->draw_color = 1;
   u8g2->is_auto_page_clear = 1;
   
+#ifdef U8G2_WITH_DIRTY_TILES
+  /* content of the buffer and the display is unknown: first dirty send is a full send */
+  memset(u8g2->tile_dirty, 0xff, sizeof(u8g2->tile_dirty));
+  memset(u8g2->tile_shown, 0xff, sizeof(u8g2->tile_shown));
+#endif
+  
   u8g2->cb = u8g2_cb;
   u8g2->cb->update_dimension(u8g2);
 #ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
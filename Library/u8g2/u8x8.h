@@ -96,6 +96,24 @@
 /* Define this for an additional user pointer inside the u8x8 data struct */
 //#define U8X8_WITH_USER_PTR
 
+/* Undefine this to remove the shadow frame diff (u8x8_SetShadowBuffer) */
+/* The diff is only active after a shadow buffer has been assigned */
+#ifndef U8X8_WITHOUT_SHADOW_DIFF
+#define U8X8_WITH_SHADOW_DIFF
+#endif
+
+/* Max size of one i2c transfer (including the control byte) for u8x8_cad_ssd13xx_stream_i2c */
+/* A value of 1025 or more sends a full 128x64 frame with one transfer */
+#ifndef U8X8_STREAM_I2C_MAX_XFER
+#define U8X8_STREAM_I2C_MAX_XFER 256
+#endif
+
+/* Bytes on the bus, which are required to start another data run (address commands, */
+/* i2c address and control bytes). Gaps up to this size are resent instead. */
+#ifndef U8X8_SHADOW_DIFF_RUN_OVERHEAD
+#define U8X8_SHADOW_DIFF_RUN_OVERHEAD 8
+#endif
+
 
 /* Undefine this to remove u8x8_SetFlipMode function */
 /* 26 May 2016: Obsolete */
@@ -366,6 +384,9 @@ struct u8x8_struct
 #ifdef U8X8_WITH_USER_PTR
   void *user_ptr;
 #endif
+#ifdef U8X8_WITH_SHADOW_DIFF
+  uint8_t *shadow_buf;	/* copy of the display RAM or NULL, see u8x8_SetShadowBuffer() */
+#endif
 #ifdef U8X8_USE_PINS 
   uint8_t pins[U8X8_PIN_CNT];	/* defines a pinlist: Mainly a list of pins for the Arduino Environment, use U8X8_PIN_xxx to access */
 #endif
@@ -583,6 +604,10 @@ void u8x8_ClearDisplayWithTile(u8x8_t *u8x8, const uint8_t *buf)  U8X8_NOINLINE;
 void u8x8_ClearDisplay(u8x8_t *u8x8);	// this does not work for u8g2 in some cases
 void u8x8_FillDisplay(u8x8_t *u8x8);
 void u8x8_RefreshDisplay(u8x8_t *u8x8);	// make RAM content visible on the display (Dec 16: SSD1606 only)
+#ifdef U8X8_WITH_SHADOW_DIFF
+void u8x8_SetShadowBuffer(u8x8_t *u8x8, uint8_t *buf);	// buf: tile_width*tile_height*8 bytes, NULL disables the diff
+#define u8x8_GetShadowBuffer(u8x8) ((u8x8)->shadow_buf)
+#endif
 void u8x8_ClearLine(u8x8_t *u8x8, uint8_t line);
 
 
@@ -666,6 +691,7 @@ uint8_t u8x8_cad_st7920_spi(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *ar
 uint8_t u8x8_cad_ssd13xx_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);        /* CAD=001 */
 uint8_t u8x8_cad_011_ssd13xx_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);     /* CAD=011 */
 uint8_t u8x8_cad_ssd13xx_fast_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);   /* CAD=001 */
+uint8_t u8x8_cad_ssd13xx_stream_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr); /* CAD=001 */
 uint8_t u8x8_cad_st75256_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
 uint8_t u8x8_cad_ld7032_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
 uint8_t u8x8_cad_uc16xx_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);  /* CAD=001 */
@@ -843,6 +869,7 @@ uint8_t u8x8_d_ssd1305_128x32_adafruit(u8x8_t *u8x8, uint8_t msg, uint8_t arg_in
 uint8_t u8x8_d_ssd1305_128x64_adafruit(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
 uint8_t u8x8_d_ssd1305_128x64_raystar(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
 uint8_t u8x8_d_ssd1306_128x64_noname(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
+uint8_t u8x8_d_ssd1306_128x64_stream(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
 uint8_t u8x8_d_ssd1306_128x64_vcomh0(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
 uint8_t u8x8_d_ssd1306_128x64_alt0(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
 uint8_t u8x8_d_ssd1309_128x64_noname0(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
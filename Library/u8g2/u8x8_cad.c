@@ -653,6 +653,92 @@ uint8_t u8x8_cad_ssd13xx_fast_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, vo
 
 
 
+/*
+  ssd13xx stream i2c:
+    Commands and their args are collected into one i2c transfer (control byte 0x00).
+    Data is appended to the currently open data transfer (control byte 0x40), 
+    even across START_TRANSFER messages. An open transfer is closed by the next 
+    command, by END_TRANSFER or after U8X8_STREAM_I2C_MAX_XFER bytes (including
+    the control byte).
+    Together with u8x8_d_ssd1306_128x64_stream, a complete frame is sent with 
+    one command transfer and (1024+1)/U8X8_STREAM_I2C_MAX_XFER data transfers.
+    The byte procedure must accept transfers of U8X8_STREAM_I2C_MAX_XFER bytes.
+*/
+uint8_t u8x8_cad_ssd13xx_stream_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+  static uint8_t stream_state = 0;	/* 0: no transfer, 1: command transfer, 2: data transfer */
+  static uint16_t stream_len = 0;		/* bytes in the current transfer */
+  uint8_t *p;
+  uint8_t cnt;
+  
+  switch(msg)
+  {
+    case U8X8_MSG_CAD_SEND_CMD:
+      if ( stream_state == 2 || (stream_state == 1 && stream_len >= U8X8_STREAM_I2C_MAX_XFER) )
+      {
+	u8x8_byte_EndTransfer(u8x8);
+	stream_state = 0;
+      }
+      if ( stream_state == 0 )
+      {
+	u8x8_byte_StartTransfer(u8x8);
+	u8x8_byte_SendByte(u8x8, 0x000);	/* cmd byte for ssd13xx controller */
+	stream_state = 1;
+	stream_len = 1;
+      }
+      u8x8_byte_SendByte(u8x8, arg_int);
+      stream_len++;
+      break;
+    case U8X8_MSG_CAD_SEND_ARG:
+      u8x8_byte_SendByte(u8x8, arg_int);
+      stream_len++;
+      break;      
+    case U8X8_MSG_CAD_SEND_DATA:
+      p = (uint8_t *)arg_ptr;
+      while( arg_int > 0 )
+      {
+	if ( stream_state == 1 || (stream_state == 2 && stream_len >= U8X8_STREAM_I2C_MAX_XFER) )
+	{
+	  u8x8_byte_EndTransfer(u8x8);
+	  stream_state = 0;
+	}
+	if ( stream_state == 0 )
+	{
+	  u8x8_byte_StartTransfer(u8x8);
+	  u8x8_byte_SendByte(u8x8, 0x040);	/* data byte for ssd13xx controller */
+	  stream_state = 2;
+	  stream_len = 1;
+	}
+	cnt = arg_int;
+	if ( stream_len + cnt > U8X8_STREAM_I2C_MAX_XFER )
+	  cnt = U8X8_STREAM_I2C_MAX_XFER - stream_len;
+	u8x8_byte_SendBytes(u8x8, cnt, p);
+	stream_len += cnt;
+	p += cnt;
+	arg_int -= cnt;
+      }
+      break;
+    case U8X8_MSG_CAD_INIT:
+      /* apply default i2c adr if required so that the start transfer msg can use this */
+      if ( u8x8->i2c_address == 255 )
+	u8x8->i2c_address = 0x078;
+      stream_state = 0;
+      return u8x8->byte_cb(u8x8, msg, arg_int, arg_ptr);
+    case U8X8_MSG_CAD_START_TRANSFER:
+      /* keep an open data transfer, the next data might continue it */
+      break;
+    case U8X8_MSG_CAD_END_TRANSFER:
+      if ( stream_state != 0 )
+	u8x8_byte_EndTransfer(u8x8); 
+      stream_state = 0;
+      break;
+    default:
+      return 0;
+  }
+  return 1;
+}
+
+
 /* the st75256 i2c driver is a copy of the ssd13xx driver, but with arg=1 */
 /* modified from cad001 (ssd13xx) to cad011 */
 uint8_t u8x8_cad_st75256_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
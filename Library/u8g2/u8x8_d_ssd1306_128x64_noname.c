@@ -35,6 +35,7 @@
 
 
 #include "u8x8.h"
+#include <string.h>
 
 
 
@@ -251,6 +252,77 @@ static const uint8_t u8x8_d_ssd1312_128x64_noname_flip1_seq[] = {
   U8X8_END()             			/* end of sequence */
 };
 
+#ifdef U8X8_WITH_SHADOW_DIFF
+/*
+  Send one run of columns. Only column and page address are required,
+  the init sequence already has set the start line.
+*/
+static void u8x8_d_ssd1306_send_run(u8x8_t *u8x8, uint8_t x, uint8_t page, uint8_t cnt, uint8_t *ptr)
+{
+  x += u8x8->x_offset;
+  u8x8_cad_SendCmd(u8x8, 0x010 | (x>>4) );
+  u8x8_cad_SendArg(u8x8, 0x000 | ((x&15)));
+  u8x8_cad_SendArg(u8x8, 0x0b0 | page);
+  u8x8_cad_SendData(u8x8, cnt, ptr);
+}
+
+/*
+  Shadow frame diff for the DRAW_TILE message: Compare the new tiles against
+  the last transmitted frame and send only the changed columns. Runs are merged,
+  if the unchanged gap between them is cheaper to resend than a new address 
+  setup (U8X8_SHADOW_DIFF_RUN_OVERHEAD).
+  The caller has to start and end the transfer.
+*/
+typedef void (*u8x8_d_ssd1306_send_run_fn)(u8x8_t *u8x8, uint8_t x, uint8_t page, uint8_t cnt, uint8_t *ptr);
+
+static void u8x8_d_ssd1306_draw_tile_diff(u8x8_t *u8x8, uint8_t arg_int, u8x8_tile_t *tile, u8x8_d_ssd1306_send_run_fn send_run)
+{
+  uint8_t *src;
+  uint8_t *shadow;
+  uint8_t x, i, n;
+  uint8_t run_start, last_diff, is_run;
+  
+  x = tile->x_pos * 8;
+  n = tile->cnt * 8;
+  do
+  {
+    src = tile->tile_ptr;
+    shadow = u8x8->shadow_buf + (uint16_t)tile->y_pos*u8x8->display_info->tile_width*8 + x;
+    is_run = 0;
+    run_start = 0;
+    last_diff = 0;
+    for( i = 0; i < n; i++ )
+    {
+      /* skip unchanged tiles */
+      if ( (i & 7) == 0 && memcmp(src+i, shadow+i, 8) == 0 )
+      {
+	i += 7;
+	continue;
+      }
+      if ( src[i] != shadow[i] )
+      {
+	if ( is_run == 0 )
+	{
+	  run_start = i;
+	  is_run = 1;
+	}
+	else if ( i - last_diff - 1 > U8X8_SHADOW_DIFF_RUN_OVERHEAD )
+	{
+	  send_run(u8x8, x+run_start, tile->y_pos, last_diff-run_start+1, src+run_start);
+	  run_start = i;
+	}
+	last_diff = i;
+	shadow[i] = src[i];
+      }
+    }
+    if ( is_run != 0 )
+      send_run(u8x8, x+run_start, tile->y_pos, last_diff-run_start+1, src+run_start);
+    x += n;
+    arg_int--;
+  } while( arg_int > 0 );
+}
+#endif
+
 static uint8_t u8x8_d_ssd1306_sh1106_generic(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
 {
   uint8_t x, c;
@@ -295,6 +367,15 @@ static uint8_t u8x8_d_ssd1306_sh1106_generic(u8x8_t *u8x8, uint8_t msg, uint8_t
       break;
 #endif
     case U8X8_MSG_DISPLAY_DRAW_TILE:
+#ifdef U8X8_WITH_SHADOW_DIFF
+      if ( u8x8->shadow_buf != NULL )
+      {
+	u8x8_cad_StartTransfer(u8x8);
+	u8x8_d_ssd1306_draw_tile_diff(u8x8, arg_int, (u8x8_tile_t *)arg_ptr, u8x8_d_ssd1306_send_run);
+	u8x8_cad_EndTransfer(u8x8);
+	break;
+      }
+#endif
       u8x8_cad_StartTransfer(u8x8);
       x = ((u8x8_tile_t *)arg_ptr)->x_pos;    
       x *= 8;
@@ -377,6 +458,117 @@ uint8_t u8x8_d_ssd1306_128x64_noname(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
   return 1;
 }
 
+/*==================================================*/
+/* 
+  SSD1306 128x64 stream: Same as the noname display, but the tiles are written in 
+  horizontal addressing mode into a column/page window (0x21/0x22). 
+  The driver remembers the position of the RAM pointer: A write which continues at
+  this position (e.g. the next tile row of a full frame) does not need any command,
+  so that a full frame is one command transfer followed by a data stream.
+  Use this with u8x8_cad_ssd13xx_stream_i2c. The data transfer is kept open until
+  the last tile of the display has been written or until u8x8_RefreshDisplay()
+  (called by u8g2_SendBuffer()).
+*/
+
+static uint8_t u8x8_d_ssd1306_stream_is_valid = 0;	/* 0: position of the RAM pointer is unknown */
+static uint8_t u8x8_d_ssd1306_stream_col;		/* RAM pointer */
+static uint8_t u8x8_d_ssd1306_stream_page;
+static uint8_t u8x8_d_ssd1306_stream_c0;		/* current window */
+static uint8_t u8x8_d_ssd1306_stream_c1;
+static uint8_t u8x8_d_ssd1306_stream_p0;
+
+static void u8x8_d_ssd1306_stream_run(u8x8_t *u8x8, uint8_t x, uint8_t page, uint8_t cnt, uint8_t *ptr)
+{
+  uint16_t col;
+  
+  x += u8x8->x_offset;
+  if ( u8x8_d_ssd1306_stream_is_valid == 0 
+	|| x != u8x8_d_ssd1306_stream_col 
+	|| page != u8x8_d_ssd1306_stream_page 
+	|| (uint16_t)x + cnt - 1 > u8x8_d_ssd1306_stream_c1 )
+  {
+    u8x8_d_ssd1306_stream_c0 = x;
+    u8x8_d_ssd1306_stream_c1 = x + cnt - 1;
+    u8x8_d_ssd1306_stream_p0 = page;
+    u8x8_d_ssd1306_stream_page = page;
+    u8x8_cad_SendCmd(u8x8, 0x021 );	/* column window */
+    u8x8_cad_SendArg(u8x8, u8x8_d_ssd1306_stream_c0 );
+    u8x8_cad_SendArg(u8x8, u8x8_d_ssd1306_stream_c1 );
+    u8x8_cad_SendCmd(u8x8, 0x022 );	/* page window */
+    u8x8_cad_SendArg(u8x8, page );
+    u8x8_cad_SendArg(u8x8, u8x8->display_info->tile_height-1 );
+    u8x8_d_ssd1306_stream_is_valid = 1;
+  }
+  u8x8_cad_SendData(u8x8, cnt, ptr);
+  
+  /* advance the RAM pointer like the controller does */
+  col = (uint16_t)x + cnt;
+  page = u8x8_d_ssd1306_stream_page;
+  if ( col > u8x8_d_ssd1306_stream_c1 )
+  {
+    col = u8x8_d_ssd1306_stream_c0;
+    page++;
+    if ( page >= u8x8->display_info->tile_height )
+      page = u8x8_d_ssd1306_stream_p0;
+  }
+  u8x8_d_ssd1306_stream_col = col;
+  u8x8_d_ssd1306_stream_page = page;
+}
+
+uint8_t u8x8_d_ssd1306_128x64_stream(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+  uint8_t x, c;
+  uint8_t *ptr;
+  
+  switch(msg)
+  {
+    case U8X8_MSG_DISPLAY_INIT:
+      u8x8_d_ssd1306_stream_is_valid = 0;
+      u8x8_d_helper_display_init(u8x8);
+      u8x8_cad_SendSequence(u8x8, u8x8_d_ssd1306_128x64_noname_init_seq);    
+      break;
+    case U8X8_MSG_DISPLAY_SETUP_MEMORY:
+      u8x8_d_helper_display_setup_memory(u8x8, &u8x8_ssd1306_128x64_noname_display_info);
+      break;
+    case U8X8_MSG_DISPLAY_SET_FLIP_MODE:
+      u8x8_d_ssd1306_stream_is_valid = 0;	/* x_offset might change */
+      return u8x8_d_ssd1306_sh1106_generic(u8x8, msg, arg_int, arg_ptr);
+    case U8X8_MSG_DISPLAY_DRAW_TILE:
+      u8x8_cad_StartTransfer(u8x8);
+#ifdef U8X8_WITH_SHADOW_DIFF
+      if ( u8x8->shadow_buf != NULL )
+      {
+	u8x8_d_ssd1306_draw_tile_diff(u8x8, arg_int, (u8x8_tile_t *)arg_ptr, u8x8_d_ssd1306_stream_run);
+      }
+      else
+#endif
+      {
+	x = ((u8x8_tile_t *)arg_ptr)->x_pos;    
+	x *= 8;
+	c = ((u8x8_tile_t *)arg_ptr)->cnt;
+	c *= 8;
+	ptr = ((u8x8_tile_t *)arg_ptr)->tile_ptr;
+	do
+	{
+	  u8x8_d_ssd1306_stream_run(u8x8, x, ((u8x8_tile_t *)arg_ptr)->y_pos, c, ptr);
+	  x += c;
+	  arg_int--;
+	} while( arg_int > 0 );
+      }
+      /* frame complete: close the data transfer */
+      if ( u8x8_d_ssd1306_stream_col == u8x8_d_ssd1306_stream_c0 && u8x8_d_ssd1306_stream_page == u8x8_d_ssd1306_stream_p0 )
+	u8x8_cad_EndTransfer(u8x8);
+      break;
+    case U8X8_MSG_DISPLAY_REFRESH:
+      u8x8_cad_EndTransfer(u8x8);
+      break;
+    default:
+      return u8x8_d_ssd1306_sh1106_generic(u8x8, msg, arg_int, arg_ptr);
+  }
+  return 1;
+}
+
+
 uint8_t u8x8_d_ssd1312_128x64_noname(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
 {
   switch(msg)
@@ -39,6 +39,7 @@
 
 
 #include "u8x8.h"
+#include <string.h>
 
 
 /*==========================================*/
@@ -182,6 +183,26 @@ void u8x8_ClearDisplay(u8x8_t *u8x8)
   u8x8_ClearDisplayWithTile(u8x8, buf);
 }
 
+#ifdef U8X8_WITH_SHADOW_DIFF
+/*
+  Description:
+    Assign a copy of the display RAM. Drivers which support the shadow
+    frame diff will compare new tiles against this copy and transfer
+    only the changed columns.
+    The display is cleared, so that the buffer matches the display RAM.
+  Args:
+    buf: tile_width*tile_height*8 bytes or NULL to disable the diff
+*/
+void u8x8_SetShadowBuffer(u8x8_t *u8x8, uint8_t *buf)
+{
+  u8x8->shadow_buf = NULL;
+  u8x8_ClearDisplay(u8x8);
+  if ( buf != NULL )
+    memset(buf, 0, (size_t)u8x8->display_info->tile_width*u8x8->display_info->tile_height*8);
+  u8x8->shadow_buf = buf;
+}
+#endif
+
 void u8x8_FillDisplay(u8x8_t *u8x8)
 {
   uint8_t buf[8] = { 255, 255, 255, 255, 255, 255, 255, 255 };
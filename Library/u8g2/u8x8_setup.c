@@ -105,6 +105,9 @@ void u8x8_SetupDefaults(u8x8_t *u8x8)
     u8x8->bus_clock = 0;		/* issue 769 */
     u8x8->i2c_address = 255;
     u8x8->debounce_default_pin_state = 255;	/* assume all low active buttons */
+#ifdef U8X8_WITH_SHADOW_DIFF
+    u8x8->shadow_buf = NULL;		/* shadow frame diff is disabled by default */
+#endif
   
 #ifdef U8X8_USE_PINS 
   {
@@ -0,0 +1,96 @@
+// 填充图形性能测试: 按 UI 的用法绘制列表高亮框 (RBox)、弹窗背景 (Box + Frame) 与砖块 (小 Box), 统计每次调用的耗时.
+// 以 -DU8G2_WITHOUT_BOX_FILL 编译得到按 hvline 绘制的对照结果 (make bench-box 会同时运行两者),
+// 两次运行的校验值 (含脏 tile 标记) 应相同
+#include "bench_util.h"
+#include "sim_ssd1306.h"
+#include "u8g2.h"
+#include <stdio.h>
+
+#define BENCH_ROUNDS 20000
+
+static void bench_check_background(u8g2_t *u8g2, int r) {
+  u8g2_DrawXBM(u8g2, 0, 0, 8, 8, (const uint8_t *)"\x55\xaa\x55\xaa\x55\xaa\x55\xaa");
+}
+
+static void bench_check_draw(u8g2_t *u8g2, int r) {
+  for (int k = 0; k < 12; k++) {
+    u8g2_uint_t x = (u8g2_uint_t)((int)(bench_rand() % 180) - 40);
+    u8g2_uint_t y = (u8g2_uint_t)((int)(bench_rand() % 100) - 20);
+    u8g2_uint_t w = 1 + bench_rand() % (k & 1 ? 8 : 90);
+    u8g2_uint_t h = 1 + bench_rand() % (k & 2 ? 6 : 50);
+    u8g2_SetDrawColor(u8g2, (uint8_t)(bench_rand() % 3));
+    switch (bench_rand() % 3) {
+    case 0: u8g2_DrawBox(u8g2, x, y, w, h); break;
+    case 1: u8g2_DrawFrame(u8g2, x, y, w, h); break;
+    default: { // u8g2 要求 w, h >= 2 * r + 1
+      u8g2_uint_t r_max = ((w < h ? w : h) - 1) / 2;
+      u8g2_DrawRBox(u8g2, x, y, w, h, bench_rand() % (r_max < 9 ? r_max + 1 : 10));
+      break;
+    }
+    }
+  }
+}
+
+// 校验: 各种尺寸 (含 1 像素宽高)、圆角半径、位置 (超出屏幕与 u8g2_uint_t 回绕的坐标)、
+// 颜色与裁剪窗口
+static unsigned long bench_check(u8g2_t *u8g2) {
+  return bench_check_loop(u8g2, bench_check_background, bench_check_draw);
+}
+
+// 高亮框: 与 vlist_draw 相同的 RBox, 每轮移动一行
+static double bench_rbox(u8g2_t *u8g2) {
+  double t0, sec = 0;
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    u8g2_ClearBuffer(u8g2);
+    t0 = bench_sec();
+    u8g2_DrawRBox(u8g2, 4, 2 + r % 40, 60 + r % 40, 13, 3);
+    sec += bench_sec() - t0;
+  }
+  return sec * 1e9 / BENCH_ROUNDS;
+}
+
+// 弹窗背景: 与 portal 相同, 先用颜色 0 清空背景再画边框
+static double bench_portal(u8g2_t *u8g2) {
+  double t0, sec = 0;
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    u8g2_ClearBuffer(u8g2);
+    t0 = bench_sec();
+    u8g2_SetDrawColor(u8g2, 0);
+    u8g2_DrawBox(u8g2, 14, 7 + r % 5, 100, 44);
+    u8g2_SetDrawColor(u8g2, 1);
+    u8g2_DrawFrame(u8g2, 14, 7 + r % 5, 100, 44);
+    sec += bench_sec() - t0;
+  }
+  return sec * 1e9 / BENCH_ROUNDS;
+}
+
+// 砖块: 与打砖块相同的 4 x 8 个 15x6 的 Box
+static double bench_bricks(u8g2_t *u8g2) {
+  double t0, sec = 0;
+  for (int r = 0; r < BENCH_ROUNDS / 10; r++) {
+    u8g2_ClearBuffer(u8g2);
+    t0 = bench_sec();
+    for (int row = 0; row < 4; row++)
+      for (int col = 0; col < 8; col++) u8g2_DrawBox(u8g2, 1 + col * 16, 3 + row * 8, 15, 6);
+    sec += bench_sec() - t0;
+  }
+  return sec * 1e9 / (BENCH_ROUNDS / 10);
+}
+
+int main(void) {
+  u8g2_t u8g2;
+
+  u8g2_Setup_ssd1306_i2c_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_sim_ssd1306,
+                                        u8x8_gpio_and_delay_sim);
+  u8g2_InitDisplay(&u8g2);
+#ifdef U8G2_WITH_BOX_FILL
+  printf("box fill: on\n");
+#else
+  printf("box fill: off\n");
+#endif
+  printf("  check %08lx\n", bench_check(&u8g2));
+  printf("  highlight RBox 13px r=3   %8.1f ns\n", bench_rbox(&u8g2));
+  printf("  portal Box + Frame 100x44 %8.1f ns\n", bench_portal(&u8g2));
+  printf("  32 bricks 15x6            %8.1f ns\n", bench_bricks(&u8g2));
+  return 0;
+}
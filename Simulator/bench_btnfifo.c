@@ -0,0 +1,86 @@
+// 按键队列压力测试: 主循环队列与中断队列各一个生产者线程, 主线程作为消费者,
+// 检查每个队列的事件按写入顺序到达且没有丢失或重复. make bench-btnfifo 会同时运行
+// ThreadSanitizer 版本, 用于确认读写计数的同步没有数据竞争. 最后统计单线程 push + pop 的耗时
+#include "bench_util.h"
+#include "btn_fifo.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+
+#ifndef BENCH_EVENTS
+#define BENCH_EVENTS 1000000 // 每个生产者写入的事件数
+#endif
+#define BENCH_ROUNDS 10000000
+
+// 两个生产者分别使用不同的按键类型, 时间戳为各自的序号
+static const struct {
+  uint8_t lane;
+  btn_type_t btn;
+} bench_producers[] = {{BTN_FIFO_LANE_MAIN, BTN_UP}, {BTN_FIFO_LANE_ISR, BTN_DOWN}};
+#define BENCH_PRODUCERS (sizeof(bench_producers) / sizeof(bench_producers[0]))
+
+static unsigned long g_full[BENCH_PRODUCERS]; // 队列满时的重试次数
+
+static void *producer(void *arg) {
+  size_t p = (size_t)arg;
+  btn_event_t ev = {.btn = bench_producers[p].btn};
+  for (uint32_t i = 0; i < BENCH_EVENTS; i++) {
+    ev.tick = i;
+    while (!btn_fifo_push_event(bench_producers[p].lane, &ev)) {
+      g_full[p]++;
+      sched_yield(); // CPU 核数少时让消费者运行
+    }
+  }
+  return NULL;
+}
+
+// 返回错误数
+static unsigned long stress(void) {
+  pthread_t th[BENCH_PRODUCERS];
+  uint32_t next[BENCH_PRODUCERS] = {0};
+  unsigned long received = 0, errors = 0, empty = 0;
+  btn_event_t ev;
+
+  btn_fifo_init();
+  for (size_t p = 0; p < BENCH_PRODUCERS; p++) pthread_create(&th[p], NULL, producer, (void *)p);
+
+  while (received < (unsigned long)BENCH_EVENTS * BENCH_PRODUCERS) {
+    if (!btn_fifo_pop_event(&ev)) {
+      empty++;
+      sched_yield();
+      continue;
+    }
+    received++;
+    size_t p = 0;
+    while (p < BENCH_PRODUCERS && bench_producers[p].btn != ev.btn) p++;
+    if (p == BENCH_PRODUCERS || ev.tick != next[p]) {
+      if (errors++ < 5) printf("  unexpected event btn %d tick %lu\n", ev.btn, (unsigned long)ev.tick);
+      if (p < BENCH_PRODUCERS) next[p] = ev.tick;
+    }
+    if (p < BENCH_PRODUCERS) next[p]++;
+  }
+
+  for (size_t p = 0; p < BENCH_PRODUCERS; p++) pthread_join(th[p], NULL);
+  if (btn_fifo_pop_event(&ev)) errors++; // 多出的事件
+  printf("  %lu events from %d threads, %lu errors (full %lu/%lu, empty %lu)\n", received,
+         (int)BENCH_PRODUCERS, errors, g_full[0], g_full[1], empty);
+  return errors;
+}
+
+int main(void) {
+  double t0, sec;
+  volatile unsigned sum = 0;
+
+  printf("btn fifo: %d lanes x %d events\n", BTN_FIFO_LANES, BTN_FIFO_SIZE);
+  unsigned long errors = stress();
+
+  btn_fifo_init();
+  t0 = bench_sec();
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    btn_fifo_push(BTN_ENTER);
+    sum += btn_fifo_pop();
+  }
+  sec = bench_sec() - t0;
+  printf("  push + pop %.1f ns\n", sec * 1e9 / BENCH_ROUNDS);
+  return errors != 0;
+}
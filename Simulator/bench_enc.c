@@ -0,0 +1,99 @@
+// 编码器事件校验: 按不同转速输入合成的转动手势, 主循环每 1ms 调用一次 enc_input_update,
+// 统计写入队列的事件数 (每个事件占用一帧) 与总步数, 对照每格一个按键事件的做法.
+// 检查慢速转动每格一步且不丢格、方向正确、相邻事件间隔不小于 ENC_INPUT_PERIOD_MS
+#include "bench_util.h"
+#include "enc_input.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define BENCH_ROUNDS 10000000
+
+static uint32_t g_now;
+static int g_fail;
+
+typedef struct {
+  int events;     // 事件数, 即界面处理输入的帧数
+  long steps;     // 步数之和, 顺时针为正
+  int min_gap;    // 相邻事件的最小间隔 (ms)
+  uint32_t last;  // 上一个事件的时刻
+} gesture_stat_t;
+
+static void collect(gesture_stat_t *st) {
+  btn_event_t ev;
+  while (btn_fifo_pop_event(&ev)) {
+    int steps = ev.steps > 1 ? ev.steps : 1;
+    st->steps += (ev.btn == ENC_INPUT_CW_BTN) ? steps : -steps;
+    if (st->events > 0 && (int)(ev.tick - st->last) < st->min_gap) st->min_gap = ev.tick - st->last;
+    st->last = ev.tick;
+    st->events++;
+  }
+}
+
+// 以 rate 格/秒转动 detents 格 (负数为逆时针), 之后静止 ENC_INPUT_IDLE_MS
+static gesture_stat_t gesture(int detents, int rate) {
+  gesture_stat_t st = {0, 0, 1 << 30, 0};
+  int n = abs(detents), dir = detents > 0 ? 1 : -1;
+  uint32_t start = g_now;
+  for (int sent = 0; sent < n || g_now - start < (uint32_t)(n * 1000 / rate + ENC_INPUT_IDLE_MS);) {
+    int due = (int)((uint64_t)(g_now - start) * rate / 1000) + 1;
+    if (due > n) due = n;
+    enc_input_update((int16_t)((due - sent) * dir), g_now);
+    sent = due;
+    collect(&st);
+    g_now++;
+  }
+  return st;
+}
+
+static void report(const char *name, int detents, int rate, gesture_stat_t st, int exact) {
+  int ok = st.min_gap >= ENC_INPUT_PERIOD_MS || st.events < 2;
+  ok = ok && (detents > 0 ? st.steps >= detents : st.steps <= detents);
+  if (exact) ok = ok && st.steps == detents;
+  printf("  %-22s %5d %5d/s %7d %7d %7ld %s\n", name, detents, rate, abs(detents), st.events,
+         st.steps, ok ? "ok" : "FAIL");
+  if (!ok) g_fail++;
+}
+
+int main(void) {
+  double t0, sec;
+
+  btn_fifo_init();
+  enc_input_init();
+  printf("encoder input: %d ms period, x1 below %d detents/s, x%d max\n", ENC_INPUT_PERIOD_MS,
+         ENC_INPUT_ACCEL_RATE * 2, ENC_INPUT_ACCEL_MAX);
+  printf("  %-22s %5s %7s %7s %7s %7s\n", "gesture", "detent", "rate", "frames0", "frames",
+         "steps");
+  // 慢速: 每格一个事件, 步数等于格数
+  report("slow cw", 10, 5, gesture(10, 5), 1);
+  report("slow ccw", -10, 8, gesture(-10, 8), 1);
+  // 中速与快速: 事件数受帧率限制, 步数随转速放大
+  report("medium", 30, 30, gesture(30, 30), 0);
+  report("fast", 60, 100, gesture(60, 100), 0);
+  report("flick", 40, 400, gesture(40, 400), 0);
+  report("flick back", -40, 400, gesture(-40, 400), 0);
+
+  // 队列满时格数保留到下次, 不丢失
+  gesture_stat_t st = {0, 0, 1 << 30, 0};
+  for (int i = 0; i < BTN_FIFO_SIZE; i++) btn_fifo_push(BTN_ENTER);
+  g_now += ENC_INPUT_IDLE_MS;
+  enc_input_update(1, g_now);
+  g_now += ENC_INPUT_IDLE_MS;
+  enc_input_update(1, g_now);
+  while (btn_fifo_pop() == BTN_ENTER) {
+  }
+  enc_input_update(0, g_now);
+  collect(&st);
+  printf("  %-22s %d event, %ld steps %s\n", "fifo full", st.events, st.steps,
+         st.events == 1 && st.steps == 2 ? "ok" : "FAIL");
+  if (st.events != 1 || st.steps != 2) g_fail++;
+
+  // 主循环每次调用的开销 (大多数调用没有新的格数)
+  t0 = bench_sec();
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    enc_input_update((r & 63) == 0, g_now + (uint32_t)r / 16);
+    if ((r & 1023) == 0) btn_fifo_clear();
+  }
+  sec = bench_sec() - t0;
+  printf("  %.1f ns/update\n", sec * 1e9 / BENCH_ROUNDS);
+  return g_fail != 0;
+}
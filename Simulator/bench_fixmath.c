@@ -0,0 +1,169 @@
+// 定点运算精度与耗时: 所有 Q16 缓动函数与 sin/cos/sqrt/exp2/pow10 对照浮点版本求最大误差,
+// 误差超出容限时返回非 0; 并测量缓动热路径 (VList/HList/portal 动画所用函数) 的单次耗时.
+// 主机有 FPU, 浮点版本在主机上并不慢; 目标板上的周期数通过串口 'e' 键测量 (见 main.c)
+#include "bench_util.h"
+#include "easing.h"
+#include "easing_q16.h"
+#include "fixmath.h"
+#include "HList.h"
+#include "VList.h"
+#include <math.h>
+#include <stdio.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAS_TSC 1
+#endif
+
+#define ACC_SAMPLES 65537 // 进度 [0, 1] 上的采样点, 覆盖全部 Q16 取值
+#define EASE_TOL 1e-3     // 缓动误差容限, 约为 128 像素行程上的 0.13 像素
+#define BENCH_CALLS 2000000
+
+typedef struct {
+  const char *name;
+  AHEasingFunction ref;
+  EasingQ16Function fix;
+} bench_ease_t;
+
+#define BENCH_EASE(fn) {#fn, fn, fn##Q16}
+static const bench_ease_t bench_eases[] = {
+    BENCH_EASE(LinearInterpolation),
+    BENCH_EASE(QuadraticEaseIn), BENCH_EASE(QuadraticEaseOut), BENCH_EASE(QuadraticEaseInOut),
+    BENCH_EASE(CubicEaseIn), BENCH_EASE(CubicEaseOut), BENCH_EASE(CubicEaseInOut),
+    BENCH_EASE(QuarticEaseIn), BENCH_EASE(QuarticEaseOut), BENCH_EASE(QuarticEaseInOut),
+    BENCH_EASE(QuinticEaseIn), BENCH_EASE(QuinticEaseOut), BENCH_EASE(QuinticEaseInOut),
+    BENCH_EASE(SineEaseIn), BENCH_EASE(SineEaseOut), BENCH_EASE(SineEaseInOut),
+    BENCH_EASE(CircularEaseIn), BENCH_EASE(CircularEaseOut), BENCH_EASE(CircularEaseInOut),
+    BENCH_EASE(ExponentialEaseIn), BENCH_EASE(ExponentialEaseOut), BENCH_EASE(ExponentialEaseInOut),
+    BENCH_EASE(ElasticEaseIn), BENCH_EASE(ElasticEaseOut), BENCH_EASE(ElasticEaseInOut),
+    BENCH_EASE(BackEaseIn), BENCH_EASE(BackEaseOut), BENCH_EASE(BackEaseInOut),
+    BENCH_EASE(BounceEaseIn), BENCH_EASE(BounceEaseOut), BENCH_EASE(BounceEaseInOut),
+};
+#define BENCH_EASE_NUM (sizeof(bench_eases) / sizeof(bench_eases[0]))
+
+// 热路径: 各组件配置的缓动函数与 portal 弹出动画
+static const bench_ease_t bench_hot[] = {
+    {"VLIST_ANIM_FUC", VLIST_ANIM_FUC, EASING_Q16(VLIST_ANIM_FUC)},
+    {"HLIST_ICON_ANIM", HLIST_ICON_ANIM, EASING_Q16(HLIST_ICON_ANIM)},
+    {"HLIST_TEXT_ANIM", HLIST_TEXT_ANIM, EASING_Q16(HLIST_TEXT_ANIM)},
+    BENCH_EASE(QuadraticEaseIn),
+};
+#define BENCH_HOT_NUM (sizeof(bench_hot) / sizeof(bench_hot[0]))
+
+static int g_fail;
+
+static double q16_to_double(q16_t v) { return v / 65536.0; }
+
+static void acc_report(const char *name, double err, double at, double tol) {
+  int ok = err <= tol;
+  printf("  %-22s max err %.2e at %9.4f%s\n", name, err, at, ok ? "" : "  FAIL");
+  if (!ok) g_fail = 1;
+}
+
+static void acc_easing(void) {
+  printf("easing (max abs error over %d samples, tolerance %.0e):\n", ACC_SAMPLES, EASE_TOL);
+  for (size_t k = 0; k < BENCH_EASE_NUM; k++) {
+    double err = 0, at = 0;
+    for (int i = 0; i < ACC_SAMPLES; i++) {
+      q16_t p = (q16_t)((int64_t)i * Q16_ONE / (ACC_SAMPLES - 1));
+      double x = q16_to_double(p);
+      double e = fabs(q16_to_double(bench_eases[k].fix(p)) - bench_eases[k].ref(x));
+      if (e > err) err = e, at = x;
+    }
+    acc_report(bench_eases[k].name, err, at, EASE_TOL);
+  }
+}
+
+static void acc_math(void) {
+  double err, at;
+
+  printf("math:\n");
+  err = at = 0;
+  for (double x = -40; x <= 40; x += 0.0007) {
+    double e = fabs(q16_to_double(fix_sin(Q16(x))) - sin(q16_to_double(Q16(x))));
+    if (e > err) err = e, at = x;
+  }
+  acc_report("fix_sin", err, at, 1e-4);
+
+  err = at = 0;
+  for (double x = -40; x <= 40; x += 0.0007) {
+    double e = fabs(q16_to_double(fix_cos(Q16(x))) - cos(q16_to_double(Q16(x))));
+    if (e > err) err = e, at = x;
+  }
+  acc_report("fix_cos", err, at, 1e-4);
+
+  // 平方根按 Q16 取整: 误差不超过一个最低位
+  err = at = 0;
+  for (int64_t v = 0; v <= INT32_MAX; v += 9973) {
+    double x = q16_to_double((q16_t)v);
+    double e = fabs(q16_to_double(fix_sqrt((q16_t)v)) - sqrt(x));
+    if (e > err) err = e, at = x;
+  }
+  acc_report("fix_sqrt", err, at, 1.0 / 65536);
+
+  // 2^x: 结果小于 1 时按绝对误差, 大于 1 时按相对误差
+  err = at = 0;
+  for (double x = -16; x <= 14; x += 0.0003) {
+    double ref = pow(2, q16_to_double(Q16(x)));
+    double e = fabs(q16_to_double(fix_exp2(Q16(x))) - ref) / (ref > 1 ? ref : 1);
+    if (e > err) err = e, at = x;
+  }
+  acc_report("fix_exp2", err, at, 1e-4);
+
+  err = at = 0;
+  for (uint8_t n = 0; n < 10; n++)
+    if (fix_pow10(n) != (uint32_t)llround(pow(10, n))) err = 1, at = n;
+  acc_report("fix_pow10", err, at, 0);
+}
+
+// 每次调用的进度不同, 与动画逐帧推进相同; 结果累加以免被优化掉
+static volatile double g_sink_f;
+static volatile q16_t g_sink_q;
+
+static void bench_hot_path(void) {
+  printf("easing hot path (%d calls each, host):\n", BENCH_CALLS);
+  for (size_t k = 0; k < BENCH_HOT_NUM; k++) {
+    const bench_ease_t *h = &bench_hot[k];
+    double t0, t_ref, t_fix, sum_f = 0;
+    q16_t sum_q = 0;
+#ifdef BENCH_HAS_TSC
+    unsigned long long c0, c_ref, c_fix;
+#endif
+
+    t0 = bench_sec();
+#ifdef BENCH_HAS_TSC
+    c0 = __rdtsc();
+#endif
+    for (int i = 0; i < BENCH_CALLS; i++) sum_f += h->ref((AHFloat)(i & 0xffff) / 65536);
+#ifdef BENCH_HAS_TSC
+    c_ref = __rdtsc() - c0;
+#endif
+    t_ref = bench_sec() - t0;
+
+    t0 = bench_sec();
+#ifdef BENCH_HAS_TSC
+    c0 = __rdtsc();
+#endif
+    for (int i = 0; i < BENCH_CALLS; i++) sum_q += h->fix(i & 0xffff);
+#ifdef BENCH_HAS_TSC
+    c_fix = __rdtsc() - c0;
+#endif
+    t_fix = bench_sec() - t0;
+
+    g_sink_f = sum_f;
+    g_sink_q = sum_q;
+    printf("  %-16s float %6.2f ns/call, q16 %6.2f ns/call", h->name, t_ref * 1e9 / BENCH_CALLS,
+           t_fix * 1e9 / BENCH_CALLS);
+#ifdef BENCH_HAS_TSC
+    printf("  (tsc %.1f / %.1f)", (double)c_ref / BENCH_CALLS, (double)c_fix / BENCH_CALLS);
+#endif
+    putchar('\n');
+  }
+}
+
+int main(void) {
+  acc_easing();
+  acc_math();
+  bench_hot_path();
+  if (g_fail) printf("ERROR: fixed point results out of tolerance\n");
+  return g_fail;
+}
@@ -0,0 +1,121 @@
+// 字体性能测试: 按菜单的用法切换字体并测量 u8g2_GetStrWidth / u8g2_DrawStr 的耗时
+// 以 -DU8G2_WITHOUT_FONT_INDEX -DU8G2_WITHOUT_GLYPH_CACHE 编译得到对照结果
+// (make bench-font 会同时运行两者), 两次运行的校验值应相同
+#include "bench_util.h"
+#include "sim_ssd1306.h"
+#include "u8g2.h"
+#include <stdio.h>
+
+#define BENCH_ROUNDS 2000
+
+static const char *bench_strs[] = {
+    "System Config", "Precise Num Test", "Save Config", "Mute Mode",
+    "Bluetooth", "Protect.false", "Brick Break (unlocked)", "Oscilloscope",
+    "Press any btn to enter", "LEFT/RIGHT:Move  BACK:Exit", "12:30:45", "50.0",
+};
+#define BENCH_STR_NUM (sizeof(bench_strs) / sizeof(bench_strs[0]))
+
+// 菜单一帧中交替使用的字体
+static const uint8_t *const bench_fonts[] = {
+    u8g2_font_6x10_tf, u8g2_font_5x7_tf, u8g2_font_8x13_tr, u8g2_font_logisoso20_tn,
+};
+#define BENCH_FONT_NUM (sizeof(bench_fonts) / sizeof(bench_fonts[0]))
+
+// 校验: 在各种位置 (跨页, 超出屏幕边缘)、颜色、字体模式与裁剪窗口下绘制, 返回缓冲区哈希
+static unsigned long bench_check(u8g2_t *u8g2) {
+  unsigned long hash = 0;
+
+  for (int r = 0; r < 64; r++) {
+    u8g2_ClearBuffer(u8g2);
+    if (r & 1) u8g2_DrawBox(u8g2, 0, 0, 64, 64);
+    if (r & 2)
+      u8g2_SetClipWindow(u8g2, 7, 5, 101, 43);
+    else
+      u8g2_SetMaxClipWindow(u8g2);
+    u8g2_SetFontMode(u8g2, (r >> 2) & 1);
+    for (size_t s = 0; s < BENCH_STR_NUM; s++)
+      for (size_t f = 0; f < BENCH_FONT_NUM; f++) {
+        u8g2_SetDrawColor(u8g2, (uint8_t)((s + f + r) % 3));
+        u8g2_SetFont(u8g2, bench_fonts[f]);
+        u8g2_DrawStr(u8g2, (int)(s * 11 + r) % 150 - 20, (int)(f * 19 + r) % 90 - 8,
+                     bench_strs[s]);
+      }
+    hash = bench_hash(u8g2, hash);
+  }
+  u8g2_SetMaxClipWindow(u8g2);
+  u8g2_SetFontMode(u8g2, 0);
+  u8g2_SetDrawColor(u8g2, 1);
+  return hash;
+}
+
+int main(void) {
+  u8g2_t u8g2;
+  unsigned long width_sum = 0, pixel_sum = 0, check_sum;
+  double t0, t_width, t_draw, t_font;
+  const uint8_t *buf;
+
+  u8g2_Setup_ssd1306_i2c_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_sim_ssd1306,
+                                        u8x8_gpio_and_delay_sim);
+  u8g2_InitDisplay(&u8g2);
+  check_sum = bench_check(&u8g2);
+#ifdef U8G2_WITH_GLYPH_CACHE
+  u8g2_ClearGlyphCache();
+#endif
+
+  // 每个字符串之前切换字体, 与 VList/portal 的绘制顺序相同
+  t0 = bench_sec();
+  for (int r = 0; r < BENCH_ROUNDS; r++)
+    for (size_t s = 0; s < BENCH_STR_NUM; s++)
+      for (size_t f = 0; f < BENCH_FONT_NUM; f++) {
+        u8g2_SetFont(&u8g2, bench_fonts[f]);
+        width_sum += u8g2_GetStrWidth(&u8g2, bench_strs[s]);
+      }
+  t_width = bench_sec() - t0;
+
+  t0 = bench_sec();
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    u8g2_ClearBuffer(&u8g2);
+    for (size_t s = 0; s < BENCH_STR_NUM; s++)
+      for (size_t f = 0; f < BENCH_FONT_NUM; f++) {
+        u8g2_SetFont(&u8g2, bench_fonts[f]);
+        u8g2_DrawStr(&u8g2, (int)(s * 3), 12 + (int)f * 16, bench_strs[s]);
+      }
+  }
+  t_draw = bench_sec() - t0;
+
+  // 只切换字体
+  t0 = bench_sec();
+  for (int r = 0; r < BENCH_ROUNDS * 10; r++)
+    for (size_t f = 0; f < BENCH_FONT_NUM; f++) u8g2_SetFont(&u8g2, bench_fonts[f]);
+  t_font = bench_sec() - t0;
+
+  buf = u8g2_GetBufferPtr(&u8g2);
+  for (int i = 0; i < 1024; i++) pixel_sum = pixel_sum * 31 + buf[i];
+
+#ifdef U8G2_WITH_FONT_INDEX
+  printf("font index: on (%d slots)", U8G2_FONT_INDEX_SLOTS);
+#else
+  printf("font index: off");
+#endif
+#ifdef U8G2_WITH_GLYPH_CACHE
+  printf(", glyph cache: on (%d bytes, %d glyphs)\n", U8G2_GLYPH_CACHE_SIZE,
+         U8G2_GLYPH_CACHE_ENTRIES);
+#else
+  printf(", glyph cache: off\n");
+#endif
+  unsigned long calls = (unsigned long)BENCH_ROUNDS * BENCH_STR_NUM * BENCH_FONT_NUM;
+  printf("  SetFont+GetStrWidth %8.1f ns/call\n", t_width * 1e9 / calls);
+  printf("  SetFont+DrawStr     %8.1f ns/call\n", t_draw * 1e9 / calls);
+  printf("  SetFont             %8.1f ns/call\n",
+         t_font * 1e9 / ((double)BENCH_ROUNDS * 10 * BENCH_FONT_NUM));
+#ifdef U8G2_WITH_GLYPH_CACHE
+  u8g2_glyph_cache_stat_t stat;
+  u8g2_GetGlyphCacheStat(&stat);
+  printf("  glyph cache: %lu hits, %lu misses, %lu evicted, %lu bypassed, %u/%d bytes\n",
+         (unsigned long)stat.hit, (unsigned long)stat.miss, (unsigned long)stat.evict,
+         (unsigned long)stat.bypass, stat.used, U8G2_GLYPH_CACHE_SIZE);
+#endif
+  printf("  check: width %lu pixels %08lx draw %08lx\n", width_sum, pixel_sum & 0xffffffffUL,
+         check_sum);
+  return 0;
+}
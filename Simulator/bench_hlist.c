@@ -0,0 +1,87 @@
+// 图标轮播性能测试: 按主菜单的用法来回切换 HList 的选中项, 统计每帧 hlist_draw 的耗时.
+// 以 -DHLIST_ICON_CACHE_SLOTS=0 编译得到直接绘制图标的对照结果 (make bench-hlist 会同时运行两者),
+// 两次运行的校验值应相同
+#include "bench_util.h"
+#include "HList.h"
+#include "sim_ssd1306.h"
+#include <stdio.h>
+
+#define BENCH_FRAMES 20000
+#define BENCH_TICK_STEP 10 // 每帧时钟步进 (ms)
+
+u8g2_t u8g2;
+const Screen_t g_screen_cfg = DEFAULT_SCREEN_CONFIG;
+
+static hlist_t g_hlist;
+static uint32_t g_tick;
+static uint8_t g_bench_xbm[2][128];
+
+// 与主菜单相同的字形图标, 加上两个位图图标
+static const uint16_t bench_glyphs[] = {0x0081, 0x0114, 0x0057, 0x0078, 0x0040, 0x00d3};
+#define BENCH_GLYPH_NUM (sizeof(bench_glyphs) / sizeof(bench_glyphs[0]))
+
+static void bench_init_hlist(void) {
+  uint32_t seed = 12345;
+  for (int i = 0; i < 2; i++)
+    for (int j = 0; j < 128; j++) {
+      seed = seed * 1103515245u + 12345u;
+      g_bench_xbm[i][j] = (uint8_t)(seed >> 16);
+    }
+  hlist_init(&g_hlist, &g_tick);
+  for (size_t i = 0; i < BENCH_GLYPH_NUM; i++) {
+    if (i == 1 || i == 4) hlist_add_xbm_item(&g_hlist, "BITMAP", g_bench_xbm[i / 4], NULL, NULL);
+    hlist_add_glyph_item(&g_hlist, "GLYPH", bench_glyphs[i], NULL, NULL);
+  }
+}
+
+// 校验: 所有动画位置 (含部分移出屏幕的图标)、背景、字体模式与位图模式
+static unsigned long bench_check(void) {
+  unsigned long hash = 0;
+
+  for (int r = 0; r < 1200; r++) {
+    u8g2_ClearBuffer(&u8g2);
+    if (r & 1) u8g2_DrawBox(&u8g2, 10, 4, 90, 30);
+    u8g2_SetFontMode(&u8g2, (r >> 1) & 1);
+    u8g2_SetBitmapMode(&u8g2, (r >> 2) & 1);
+    g_hlist.from_index = (r >> 3) % g_hlist.count;
+    g_hlist.to_index = (r * 5 + 3) % g_hlist.count;
+    g_hlist.start_tick = 0;
+    g_tick = (uint32_t)(r * 7) % (HLIST_ANIM_MS + 20);
+    HLIST_COMP.draw(&u8g2, &g_hlist);
+    hash = bench_hash(&u8g2, hash);
+  }
+  u8g2_SetFontMode(&u8g2, 0);
+  u8g2_SetBitmapMode(&u8g2, 0);
+  return hash;
+}
+
+int main(void) {
+  unsigned long hash = 0;
+  double t0, sec = 0;
+  int dir = 1;
+
+  u8g2_Setup_ssd1306_i2c_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_sim_ssd1306,
+                                        u8x8_gpio_and_delay_sim);
+  u8g2_InitDisplay(&u8g2);
+  bench_init_hlist();
+  printf("hlist icon cache: %d icons\n", HLIST_ICON_CACHE_SLOTS);
+  printf("  check %08lx\n", bench_check());
+
+  // 每次动画结束后切换到相邻项, 到两端时反向
+  g_hlist.from_index = g_hlist.to_index = 0;
+  g_hlist.start_tick = g_tick = 0;
+  for (int f = 0; f < BENCH_FRAMES; f++, g_tick += BENCH_TICK_STEP) {
+    if (g_tick - g_hlist.start_tick >= HLIST_ANIM_MS) {
+      if (g_hlist.to_index + dir < 0 || g_hlist.to_index + dir >= g_hlist.count) dir = -dir;
+      HLIST_COMP.input(dir > 0 ? BTN_RIGHT : BTN_LEFT, &g_hlist);
+    }
+    u8g2_ClearBuffer(&u8g2);
+    t0 = bench_sec();
+    HLIST_COMP.draw(&u8g2, &g_hlist);
+    sec += bench_sec() - t0;
+    hash = bench_hash(&u8g2, hash);
+  }
+  printf("  %d items carousel %.2f us/frame, frames %08lx\n", g_hlist.count,
+         sec * 1e6 / BENCH_FRAMES, hash);
+  return 0;
+}
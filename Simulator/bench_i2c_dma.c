@@ -0,0 +1,264 @@
+// I2C DMA 传输队列校验: 模拟外设在启动后 N us 完成传输 (每字节 BENCH_BYTE_US),
+// 完成时在 "中断" 中调用 i2c_dma_on_complete 接续发送下一个事务.
+// 检查队列满 / 数据池回绕时主循环等待且不丢事务、传输期间数据池未被覆盖、
+// 接续启动只发生在完成中断中、每段忙碌以一次排空回调结束 (此时 i2c_dma_is_busy 为 false),
+// 最后经 u8g2 (noname / stream 驱动) 发送整帧与脏 tile, 校验虚拟显存与缓冲区一致
+#include "i2c_dma.h"
+#include "sim_ssd1306.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_START_US 5   // 每次传输的起始/地址/停止开销
+#define BENCH_BYTE_US 23   // 400kHz 下每字节 9 个时钟
+#define BENCH_CALL_US 1    // 主循环每次调用字节层回调的耗时
+#define BENCH_DRAW_US 4000 // 两帧之间主循环绘制的耗时
+#define BENCH_FRAMES 60
+#define BENCH_LOG_SIZE (1 << 20)
+
+// 模拟外设
+typedef struct {
+  uint32_t now;        // 虚拟时钟 (us)
+  uint32_t done_at;    // 当前传输的完成时刻
+  const uint8_t *data; // DMA 读取的地址, 完成时才读出
+  uint8_t copy[I2C_DMA_MAX_XFER];
+  uint16_t len;
+  uint8_t addr;
+  bool inflight;
+  bool in_isr;
+  // 统计
+  unsigned long kicks;    // 主循环中启动 (队列空闲)
+  unsigned long chained;  // 完成中断中接续启动
+  unsigned long wraps;    // 接续事务的数据地址回到数据池前部
+  unsigned long waits;    // 主循环等待 (队列或数据池已满, 或等待排空)
+  unsigned long idle_cbs; // 排空回调次数
+  unsigned long blocked;  // 主循环等待的总时长 (us)
+  unsigned long bus;      // 总线占用时长 (us)
+  const uint8_t *last_data;
+  // 完成的事务按顺序写入日志: 地址, 长度 (2 字节), 数据
+  uint8_t log[BENCH_LOG_SIZE];
+  uint32_t log_len;
+  bool to_panel; // 同时写入虚拟 SSD1306
+} bench_port_t;
+
+static bench_port_t g_port;
+static int g_fail;
+
+static void bench_check(int ok, const char *what) {
+  if (!ok) {
+    printf("  FAIL: %s\n", what);
+    g_fail++;
+  }
+}
+
+static void bench_port_start(uint8_t addr, const uint8_t *data, uint16_t len) {
+  bench_port_t *p = &g_port;
+
+  bench_check(!p->inflight, "start while a transfer is running");
+  bench_check(len > 0 && len <= I2C_DMA_MAX_XFER, "transfer length");
+  if (p->in_isr) {
+    p->chained++;
+    if (data < p->last_data) p->wraps++;
+  } else {
+    p->kicks++;
+    bench_check(i2c_dma_is_busy(), "busy while the first transfer starts");
+  }
+  p->addr = addr;
+  p->data = data;
+  p->len = len;
+  memcpy(p->copy, data, len);
+  p->last_data = data;
+  p->done_at = p->now + BENCH_START_US + len * BENCH_BYTE_US;
+  p->bus += BENCH_START_US + len * BENCH_BYTE_US;
+  p->inflight = true;
+}
+
+// 传输完成中断
+static void bench_port_complete(void) {
+  bench_port_t *p = &g_port;
+
+  p->now = p->done_at;
+  p->inflight = false;
+  // DMA 在整个传输期间读取数据池, 期间被写入的事务会发出错误的字节
+  bench_check(memcmp(p->copy, p->data, p->len) == 0, "pool overwritten during transfer");
+  if (p->log_len + 3 + p->len <= BENCH_LOG_SIZE) {
+    p->log[p->log_len++] = p->addr;
+    p->log[p->log_len++] = (uint8_t)(p->len >> 8);
+    p->log[p->log_len++] = (uint8_t)p->len;
+    memcpy(p->log + p->log_len, p->data, p->len);
+    p->log_len += p->len;
+  }
+  if (p->to_panel) {
+    u8x8_byte_sim_ssd1306(NULL, U8X8_MSG_BYTE_START_TRANSFER, 0, NULL);
+    for (uint16_t i = 0; i < p->len; i += 128) {
+      uint16_t n = p->len - i < 128 ? p->len - i : 128;
+      u8x8_byte_sim_ssd1306(NULL, U8X8_MSG_BYTE_SEND, (uint8_t)n, (void *)(p->data + i));
+    }
+    u8x8_byte_sim_ssd1306(NULL, U8X8_MSG_BYTE_END_TRANSFER, 0, NULL);
+  }
+  p->in_isr = true;
+  i2c_dma_on_complete();
+  p->in_isr = false;
+}
+
+// 主循环等待: 运行到当前传输完成
+static void bench_port_wait(void) {
+  bench_port_t *p = &g_port;
+
+  if (!p->inflight) {
+    printf("  FAIL: waiting with no transfer running\n");
+    exit(1);
+  }
+  p->waits++;
+  p->blocked += p->done_at - p->now;
+  bench_port_complete();
+}
+
+// 主循环运行 us 微秒, 期间完成的传输在中断中接续
+static void bench_advance(uint32_t us) {
+  bench_port_t *p = &g_port;
+  uint32_t end = p->now + us;
+
+  while (p->inflight && (int32_t)(p->done_at - end) <= 0) bench_port_complete();
+  p->now = end;
+}
+
+static void bench_idle_cb(void) {
+  g_port.idle_cbs++;
+  bench_check(!i2c_dma_is_busy(), "busy in the idle callback");
+}
+
+static const i2c_dma_port_t bench_port = {
+    .start = bench_port_start,
+    .wait = bench_port_wait,
+};
+
+static void bench_reset(bool to_panel) {
+  memset(&g_port, 0, sizeof(g_port));
+  g_port.to_panel = to_panel;
+  i2c_dma_init(&bench_port);
+  i2c_dma_register_idle_cb(bench_idle_cb);
+}
+
+// 字节层回调: 主循环每次调用耗时 BENCH_CALL_US
+static uint8_t bench_byte_cb(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr) {
+  bench_advance(BENCH_CALL_US);
+  return u8x8_byte_i2c_dma(u8x8, msg, arg_int, arg_ptr);
+}
+
+// 第 i 个事务的内容: 长度 len, 字节由序号生成
+static uint8_t bench_pattern(int i, int k) { return (uint8_t)(i * 31 + k * 7 + (i >> 8)); }
+
+// 直接调用字节层写入 count 个事务, 长度由 len_of 给出, 之后检查日志与写入一致
+static void bench_queue(const char *name, int count, int (*len_of)(int), int gap_us) {
+  u8x8_t u8x8;
+  uint8_t buf[I2C_DMA_MAX_XFER];
+  uint32_t pos = 0;
+  int bad = 0;
+
+  memset(&u8x8, 0, sizeof(u8x8));
+  u8x8_SetI2CAddress(&u8x8, 0x78);
+  bench_reset(false);
+  for (int i = 0; i < count; i++) {
+    int len = len_of(i);
+    for (int k = 0; k < len; k++) buf[k] = bench_pattern(i, k);
+    bench_byte_cb(&u8x8, U8X8_MSG_BYTE_START_TRANSFER, 0, NULL);
+    // 分成多次 BYTE_SEND, 与 cad 层的调用方式相同
+    for (int k = 0; k < len; k += 100) {
+      int n = len - k < 100 ? len - k : 100;
+      bench_byte_cb(&u8x8, U8X8_MSG_BYTE_SEND, (uint8_t)n, buf + k);
+    }
+    bench_byte_cb(&u8x8, U8X8_MSG_BYTE_END_TRANSFER, 0, NULL);
+    bench_advance(gap_us);
+  }
+  i2c_dma_wait_idle();
+
+  for (int i = 0; i < count && !bad; i++) {
+    int len = len_of(i);
+    if (pos + 3 + len > g_port.log_len || g_port.log[pos] != 0x78 ||
+        (g_port.log[pos + 1] << 8 | g_port.log[pos + 2]) != len) {
+      bad = 1;
+      break;
+    }
+    for (int k = 0; k < len; k++)
+      if (g_port.log[pos + 3 + k] != bench_pattern(i, k)) bad = 1;
+    pos += 3 + len;
+  }
+  bad = bad || pos != g_port.log_len;
+  printf("  %-18s %6d %8lu %8lu %6lu %6lu %8lu %s\n", name, count, g_port.kicks, g_port.chained,
+         g_port.wraps, g_port.waits, g_port.idle_cbs, bad ? "FAIL" : "ok");
+  bench_check(!bad, "transfers lost, reordered or corrupted");
+  bench_check(g_port.idle_cbs == g_port.kicks, "one idle callback per busy period");
+  bench_check(!i2c_dma_is_busy() && !g_port.inflight, "idle after i2c_dma_wait_idle");
+}
+
+static int bench_len_tiny(int i) { return 2 + (i & 1); }
+static int bench_len_max(int i) { return I2C_DMA_MAX_XFER - (i % 3) * 40; }
+static int bench_len_mixed(int i) { return 1 + (i * 37) % I2C_DMA_MAX_XFER; }
+
+// 经 u8g2 发送 BENCH_FRAMES 帧, 每帧后检查虚拟显存 (数据仍在排队时先等待排空)
+static void bench_frames(const char *name, void (*setup)(u8g2_t *, const u8g2_cb_t *, u8x8_msg_cb,
+                                                         u8x8_msg_cb),
+                         bool dirty) {
+  u8g2_t u8g2;
+  int bad = 0;
+  unsigned long blocked;
+
+  bench_reset(true);
+  sim_ssd1306_reset();
+  setup(&u8g2, U8G2_R0, bench_byte_cb, u8x8_gpio_and_delay_sim);
+  u8g2_InitDisplay(&u8g2);
+  u8g2_SetPowerSave(&u8g2, 0);
+  u8g2_ClearBuffer(&u8g2);
+  u8g2_SendBuffer(&u8g2);
+  i2c_dma_wait_idle();
+  blocked = g_port.blocked;
+  u8g2_SetFont(&u8g2, u8g2_font_6x10_tf);
+  for (int frame = 0; frame < BENCH_FRAMES; frame++) {
+    u8g2_ClearBuffer(&u8g2);
+    u8g2_DrawStr(&u8g2, 2, 12, "I2C DMA");
+    u8g2_SetDrawColor(&u8g2, 2);
+    u8g2_DrawBox(&u8g2, frame % 100, 16 + frame % 40, 28, 12);
+    u8g2_SetDrawColor(&u8g2, 1);
+    for (int x = 0; x < 128; x += 3) u8g2_DrawPixel(&u8g2, x, (x * 7 + frame * 5) % 64);
+    if (dirty)
+      u8g2_SendDirtyBuffer(&u8g2);
+    else
+      u8g2_SendBuffer(&u8g2);
+    // 帧间绘制期间传输在中断中继续
+    bench_advance(BENCH_DRAW_US);
+    i2c_dma_wait_idle();
+    if (sim_ssd1306_compare(&u8g2) != 0) bad++;
+  }
+  printf("  %-18s %6d %8lu %8lu %6lu %6lu %8lu %s  bus %.2f ms/f, wait %.2f ms/f\n", name,
+         BENCH_FRAMES, g_port.kicks, g_port.chained, g_port.wraps, g_port.waits, g_port.idle_cbs,
+         bad ? "FAIL" : "ok", g_port.bus / 1000.0 / BENCH_FRAMES,
+         (g_port.blocked - blocked) / 1000.0 / BENCH_FRAMES);
+  bench_check(!bad, "panel differs from the frame buffer");
+  bench_check(g_port.idle_cbs == g_port.kicks, "one idle callback per busy period");
+}
+
+int main(void) {
+  printf("i2c_dma: queue %d, pool %d, max xfer %d, %d us/byte\n", I2C_DMA_QUEUE_LEN,
+         I2C_DMA_POOL_SIZE, I2C_DMA_MAX_XFER, BENCH_BYTE_US);
+  printf("  %-18s %6s %8s %8s %6s %6s %8s\n", "case", "xfers", "kicks", "chained", "wraps",
+         "waits", "idle_cb");
+  // 队列满: 大量短事务一次写入
+  bench_queue("queue full", 1000, bench_len_tiny, 0);
+  bench_check(g_port.waits > 0, "queue full stalls the main loop");
+  // 数据池回绕: 接近上限的长事务
+  bench_queue("pool wrap", 200, bench_len_max, 0);
+  bench_check(g_port.wraps > 0, "pool wraps around");
+  bench_queue("mixed", 2000, bench_len_mixed, 0);
+  // 事务之间主循环空闲, 队列多次排空后重新启动
+  bench_queue("sparse", 300, bench_len_mixed, 3000);
+  bench_check(g_port.kicks > 1, "sparse run restarts from idle");
+
+  bench_frames("noname full", u8g2_Setup_ssd1306_i2c_128x64_noname_f, false);
+  bench_frames("noname dirty", u8g2_Setup_ssd1306_i2c_128x64_noname_f, true);
+  bench_frames("stream full", u8g2_Setup_ssd1306_i2c_128x64_stream_f, false);
+  bench_frames("stream dirty", u8g2_Setup_ssd1306_i2c_128x64_stream_f, true);
+
+  if (g_fail) printf("ERROR: %d checks failed\n", g_fail);
+  return g_fail != 0;
+}
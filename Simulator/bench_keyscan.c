@@ -0,0 +1,154 @@
+// 按键扫描校验: 用带抖动的合成电平序列驱动 key_scan_update, 检查产生的按下/松开/长按事件,
+// 并统计 8 个按键时每次采样的耗时 (定时器中断中的开销)
+#include "bench_util.h"
+#include "key_scan.h"
+#include <stdio.h>
+
+#define BENCH_ROUNDS 1000000
+#define LONG_SAMPLES ((KEY_SCAN_LONG_MS + KEY_SCAN_PERIOD_MS - 1) / KEY_SCAN_PERIOD_MS)
+
+// 按键 0: 按下 UP, 松开 DOWN, 长按 LONG_PRESS; 按键 1: 只在松开时产生 ENTER, 长按 BACK
+static const key_scan_cfg_t bench_cfg[KEY_SCAN_MAX_KEYS] = {
+    {.press = BTN_UP, .release = BTN_DOWN, .long_press = BTN_LONG_PRESS},
+    {.press = BTN_NONE, .release = BTN_ENTER, .long_press = BTN_BACK},
+};
+
+static char g_events[4096]; // 事件记录, 每个事件一个字符
+static int g_event_len;
+static int g_fail;
+
+static char bench_event_char(btn_type_t btn) {
+  switch (btn) {
+  case BTN_UP: return 'u';
+  case BTN_DOWN: return 'd';
+  case BTN_LONG_PRESS: return 'L';
+  case BTN_ENTER: return 'e';
+  case BTN_BACK: return 'b';
+  default: return '?';
+  }
+}
+
+// 输入一次采样并记录产生的事件: u/d/L 为按键 0 的按下/松开/长按, e/b 为按键 1 的松开/长按
+static void feed(uint32_t pressed) {
+  btn_type_t btn;
+  key_scan_update(pressed);
+  while ((btn = btn_fifo_pop()) != BTN_NONE)
+    if (g_event_len < (int)sizeof(g_events) - 1) g_events[g_event_len++] = bench_event_char(btn);
+  g_events[g_event_len] = 0;
+}
+
+// 按键 key 在 n 次采样内保持 level, 前 bounce 次采样随机抖动
+static void hold(int key, int level, int n, int bounce) {
+  for (int i = 0; i < n; i++) {
+    int v = (i < bounce) ? (int)(bench_rand() & 1) : level;
+    feed((uint32_t)v << key);
+  }
+}
+
+static void expect(const char *name, const char *want) {
+  int ok = 0;
+  for (int i = 0;; i++) {
+    if (want[i] != g_events[i]) break;
+    if (want[i] == 0) {
+      ok = 1;
+      break;
+    }
+  }
+  printf("  %-34s %-8s %s\n", name, g_events, ok ? "ok" : "FAIL");
+  if (!ok) {
+    printf("    expected %s\n", want);
+    g_fail++;
+  }
+  g_event_len = 0;
+  g_events[0] = 0;
+}
+
+static void check(void) {
+  const int stable = KEY_SCAN_DEBOUNCE_SAMPLES;
+
+  key_scan_init(bench_cfg, 2);
+  hold(0, 1, stable + 3, 0);
+  hold(0, 0, stable + 3, 0);
+  expect("clean click", "ud");
+
+  // 抖动 (短于 2 倍消抖窗口) 期间最多切换一次状态, 按下与松开各产生一次
+  hold(0, 1, 40, stable * 2 - 1);
+  hold(0, 0, 40, stable * 2 - 1);
+  expect("bouncing click", "ud");
+
+  // 短于消抖窗口的毛刺不产生事件
+  for (int w = 1; w < stable; w++) {
+    hold(0, 1, w, 0);
+    hold(0, 0, stable + 2, 0);
+  }
+  expect("glitches shorter than debounce", "");
+
+  // 长按只触发一次, 之后松开不再产生松开事件
+  hold(0, 1, stable + LONG_SAMPLES * 3, 5);
+  hold(0, 0, stable + 7, 5);
+  expect("long press, key 0", "uL");
+  hold(1, 1, stable + LONG_SAMPLES * 3, 5);
+  hold(1, 0, stable + 7, 5);
+  expect("long press, key 1", "b");
+
+  // 长按阈值: 没有抖动时按住 LONG_SAMPLES + 1 次采样触发 (松开的消抖期间仍在计时)
+  hold(1, 1, LONG_SAMPLES, 0);
+  hold(1, 0, stable + 2, 0);
+  expect("just below long press, key 1", "e");
+  hold(1, 1, LONG_SAMPLES + 1, 0);
+  hold(1, 0, stable + 2, 0);
+  expect("just above long press, key 1", "b");
+
+  // 两个按键同时按下, 互不影响
+  for (int i = 0; i < stable + 2; i++) feed(3);
+  for (int i = 0; i < stable + 2; i++) feed(2);
+  for (int i = 0; i < stable + 2; i++) feed(0);
+  expect("two keys", "ude");
+
+  // 随机按下时长与抖动 (少于 2 倍消抖窗口, 不会被误判为两次按下): 每次按下恰好产生一个事件
+  int clicks = 0, longs = 0, bad = 0;
+  for (int r = 0; r < 2000; r++) {
+    int bounce = bench_rand() % (stable * 2);
+    int down = stable + bounce + bench_rand() % (LONG_SAMPLES * 2);
+    hold(1, 1, down, bounce);
+    hold(1, 0, stable + bounce + bench_rand() % 20, bounce);
+    // 抖动可能使按下提前或松开推迟, 按住计数的范围为 [hold_min, hold_max]
+    int hold_min = down - bounce - stable, hold_max = down + bounce - 2;
+    char want = 0;
+    if (hold_min >= LONG_SAMPLES) {
+      want = 'b';
+      longs++;
+    } else if (hold_max < LONG_SAMPLES) {
+      want = 'e';
+      clicks++;
+    }
+    if (g_event_len != 1 || (want && g_events[0] != want)) bad++;
+    g_event_len = 0;
+  }
+  printf("  %-34s %d click, %d long, %d bad %s\n", "random bounce and hold", clicks, longs, bad,
+         bad ? "FAIL" : "ok");
+  if (bad) g_fail++;
+  g_events[0] = 0;
+}
+
+int main(void) {
+  double t0, sec;
+  uint32_t pins = 0;
+
+  btn_fifo_init();
+  printf("key scan: %d ms period, %d samples debounce, %d ms long press\n", KEY_SCAN_PERIOD_MS,
+         KEY_SCAN_DEBOUNCE_SAMPLES, KEY_SCAN_LONG_MS);
+  check();
+
+  // 8 个按键, 每 64 次采样改变一次电平
+  key_scan_init(bench_cfg, KEY_SCAN_MAX_KEYS);
+  t0 = bench_sec();
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    if ((r & 63) == 0) pins = bench_rand() & 0xff;
+    key_scan_update(pins);
+    if ((r & 7) == 0) btn_fifo_clear();
+  }
+  sec = bench_sec() - t0;
+  printf("  8 keys %.1f ns/update\n", sec * 1e9 / BENCH_ROUNDS);
+  return g_fail != 0;
+}
@@ -0,0 +1,80 @@
+// 滚动文字性能测试: 按列表的用法逐帧绘制几条超出宽度的标题, 统计 draw_scroll_text_with_pause 的耗时.
+// 以 -DMARQUEE_STRIP_SLOTS=0 编译得到逐字绘制的对照结果 (make bench-marquee 会同时运行两者),
+// 两次运行的校验值应相同
+#include "bench_util.h"
+#include "ui_toolkit.h"
+#include "sim_ssd1306.h"
+#include <stdio.h>
+
+#define BENCH_FRAMES 20000
+#define BENCH_TICK_STEP 7 // 每帧时钟步进 (ms), 与滚动速度互质以覆盖所有偏移
+
+u8g2_t u8g2;
+const Screen_t g_screen_cfg = DEFAULT_SCREEN_CONFIG;
+
+static const char *bench_titles[] = {
+    "Precise Num Test with a long title", "Brick Break (unlocked)", "Press any btn to enter",
+    "LEFT/RIGHT:Move  BACK:Exit", "Channel 00042 temperature sensor",
+};
+#define BENCH_TITLE_NUM (sizeof(bench_titles) / sizeof(bench_titles[0]))
+
+static const uint8_t *const bench_fonts[] = {
+    u8g2_font_6x10_tf, u8g2_font_5x7_tf, u8g2_font_8x13_tr, u8g2_font_logisoso20_tn,
+};
+#define BENCH_FONT_NUM (sizeof(bench_fonts) / sizeof(bench_fonts[0]))
+
+// 校验: 各种字体、颜色、字体模式、裁剪区域 (含超出屏幕与 uint8_t 回绕的坐标) 与背景
+static unsigned long bench_check(void) {
+  unsigned long hash = 0;
+  uint32_t tick = 0;
+
+  for (int r = 0; r < 1500; r++, tick += 37) {
+    u8g2_ClearBuffer(&u8g2);
+    if (r & 1) u8g2_DrawBox(&u8g2, 0, 8, 90, 30);
+    u8g2_SetFontMode(&u8g2, (r >> 1) & 1);
+    for (size_t t = 0; t < BENCH_TITLE_NUM; t++) {
+      int k = r + (int)t;
+      u8g2_SetFont(&u8g2, bench_fonts[k % BENCH_FONT_NUM]);
+      u8g2_SetDrawColor(&u8g2, (uint8_t)(k % 3));
+      int y = (k * 13) % 80 - 4;
+      draw_scroll_text_with_pause(&u8g2, &g_screen_cfg, bench_titles[t], (uint8_t)(k * 7 % 60),
+                                  (uint8_t)(20 + k * 11 % 90), (uint8_t)y, tick + t * 500,
+                                  (uint8_t)(y - 10 + k % 5), (uint8_t)(y + 3 - k % 4));
+    }
+    hash = bench_hash(&u8g2, hash);
+  }
+  u8g2_SetFontMode(&u8g2, 0);
+  u8g2_SetDrawColor(&u8g2, 1);
+  return hash;
+}
+
+int main(void) {
+  unsigned long hash = 0;
+  uint32_t tick = 0;
+  double t0, sec = 0;
+
+  u8g2_Setup_ssd1306_i2c_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_sim_ssd1306,
+                                        u8x8_gpio_and_delay_sim);
+  u8g2_InitDisplay(&u8g2);
+  printf("marquee strips: %d slots, %d byte arena\n", MARQUEE_STRIP_SLOTS, MARQUEE_STRIP_ARENA);
+  printf("  check %08lx\n", bench_check());
+
+  // 列表的一帧: 高亮行用颜色 0 绘制在高亮框内, 其余两行用颜色 1
+  u8g2_SetFont(&u8g2, g_screen_cfg.font);
+  for (int f = 0; f < BENCH_FRAMES; f++, tick += BENCH_TICK_STEP) {
+    u8g2_ClearBuffer(&u8g2);
+    u8g2_DrawRBox(&u8g2, 6, 14, 90, 13, 3);
+    t0 = bench_sec();
+    for (int row = 0; row < 3; row++) {
+      int y = 12 + row * 13;
+      u8g2_SetDrawColor(&u8g2, row == 1 ? 0 : 1);
+      draw_scroll_text_with_pause(&u8g2, &g_screen_cfg, bench_titles[row], 13, 80, y, tick,
+                                  y - 9, y + 2);
+    }
+    sec += bench_sec() - t0;
+    hash = bench_hash(&u8g2, hash);
+  }
+  u8g2_SetDrawColor(&u8g2, 1);
+  printf("  3 scrolling rows %.2f us/frame, frames %08lx\n", sec * 1e6 / BENCH_FRAMES, hash);
+  return 0;
+}
@@ -0,0 +1,110 @@
+// 数值格式化校验与耗时: num_fmt_float / num_fmt_uint 对照 snprintf 的 "%0*.*f" / "%0*u",
+// 覆盖列表与 portal 所用的数值范围、按步长累加得到的数值、舍入边界与随机位模式, 输出不一致时返回非 0.
+// 主机的 printf 有 FPU 支持, 耗时仅供参考; 目标板上省去的是软件浮点与 printf 浮点格式化
+#include "bench_util.h"
+#include "num_fmt.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define BENCH_CALLS 2000000
+
+static unsigned long g_checked, g_bad;
+
+static void check_float(float val, uint8_t decimals, uint8_t width) {
+  char ref[48], out[48];
+  snprintf(ref, sizeof(ref), "%0*.*f", width, decimals, val);
+  uint8_t len = num_fmt_float(out, sizeof(out), val, decimals, width);
+  g_checked++;
+  if (strcmp(ref, out) != 0 || len != strlen(ref)) {
+    if (g_bad++ < 10)
+      printf("  MISMATCH %a (%.9g) .%u w%u: \"%s\" != \"%s\"\n", val, val, decimals, width, out,
+             ref);
+  }
+}
+
+static void check_uint(uint32_t val, uint8_t width) {
+  char ref[16], out[16];
+  snprintf(ref, sizeof(ref), "%0*u", width, (unsigned)val);
+  uint8_t len = num_fmt_uint(out, sizeof(out), val, width);
+  g_checked++;
+  if (strcmp(ref, out) != 0 || len != strlen(ref)) {
+    if (g_bad++ < 10) printf("  MISMATCH %u w%u: \"%s\" != \"%s\"\n", val, width, out, ref);
+  }
+}
+
+// bench_rand 只有 24 位, 随机位模式需要完整的 32 位
+static uint32_t bench_rand32(void) { return bench_rand() << 16 ^ bench_rand(); }
+
+static float bits_to_float(uint32_t bits) {
+  float f;
+  memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+static void check_all(void) {
+  // 列表/portal 的数值: k/10, k/100 与 portal 精确输入的 total_digit/dot_pos 组合
+  for (int k = -200000; k <= 200000; k++) {
+    check_float(k / 10.0f, 1, 0);
+    check_float(k / 100.0f, 1, 0);
+    check_float(k / 100.0f, 2, 6);
+    check_float(k * 0.1f, 0, 0);
+    check_float((float)k, 0, 5);
+    check_float(k / 1000.0f, 3, 7);
+  }
+  // 按步长累加 (NUM_EDIT 的 UP/DOWN), 误差在累加中积累
+  static const float steps[] = {0.1f, 0.5f, 1.0f, 0.05f, 2.5f};
+  for (size_t i = 0; i < sizeof(steps) / sizeof(steps[0]); i++) {
+    float v = -100.0f;
+    for (int n = 0; n < 40000 && v < 1000.0f; n++, v = fminf(v + steps[i], 1000.0f))
+      for (uint8_t d = 0; d <= 3; d++) check_float(v, d, d ? 6 : 4);
+  }
+  // 舍入边界: x.5 (五成双) 与其相邻的浮点数, 各种宽度
+  for (int k = -2000; k <= 2000; k++) {
+    float h = k + 0.5f;
+    for (uint8_t w = 0; w <= 8; w++) {
+      check_float(h, 0, w);
+      check_float(nextafterf(h, 1e9f), 0, w);
+      check_float(nextafterf(h, -1e9f), 0, w);
+      check_float(k / 100.0f + 0.005f, 2, w);
+      check_float(k / 8.0f, 2, w); // 精确的 xx.125 / xx.375
+    }
+  }
+  // 特殊值
+  static const uint32_t special[] = {
+      0x00000000, 0x80000000, 0x00000001, 0x807fffff, 0x3f000000, 0xbf000000,
+      0x4f7fffff, 0xcf7fffff, 0x7f800000, 0xff800000, 0x7fc00000, 0xffc00000,
+  };
+  for (size_t i = 0; i < sizeof(special) / sizeof(special[0]); i++)
+    for (uint8_t d = 0; d <= NUM_FMT_MAX_DECIMALS; d++)
+      for (uint8_t w = 0; w <= 12; w += 3) check_float(bits_to_float(special[i]), d, w);
+  // 随机位模式, |val| < 2^32
+  for (int i = 0; i < 2000000; i++) {
+    uint32_t bits = bench_rand32();
+    if (((bits >> 23) & 0xff) > 158) bits = (bits & 0x807fffff) | ((bits >> 24 & 0x7f) << 23);
+    check_float(bits_to_float(bits), bits % (NUM_FMT_MAX_DECIMALS + 1), (bits >> 8) % 14);
+  }
+  for (uint32_t v = 0; v <= 65535; v++) check_uint(v, v % 7);
+  for (int i = 0; i < 100000; i++) check_uint(bench_rand32(), i % 12);
+}
+
+int main(void) {
+  char buf[32];
+  volatile float vals[64];
+  unsigned long sum = 0;
+  double t0, t_ref, t_fmt;
+
+  check_all();
+  printf("check: %lu values, %lu mismatches\n", g_checked, g_bad);
+
+  for (int i = 0; i < 64; i++) vals[i] = (i - 20) * 1.7f;
+  t0 = bench_sec();
+  for (int i = 0; i < BENCH_CALLS; i++) sum += snprintf(buf, sizeof(buf), "%.1f", vals[i & 63]);
+  t_ref = bench_sec() - t0;
+  t0 = bench_sec();
+  for (int i = 0; i < BENCH_CALLS; i++) sum += num_fmt_float(buf, sizeof(buf), vals[i & 63], 1, 0);
+  t_fmt = bench_sec() - t0;
+  printf("\"%%.1f\": snprintf %.1f ns/call, num_fmt_float %.1f ns/call (%lu)\n",
+         t_ref * 1e9 / BENCH_CALLS, t_fmt * 1e9 / BENCH_CALLS, sum);
+  return g_bad != 0;
+}
@@ -0,0 +1,147 @@
+// 传输层字节统计: 比较 ssd1306 noname (逐行页寻址) 与 stream (水平寻址连续流)
+// 在整帧 / 脏 tile / 影子缓冲逐列比较 (u8x8_SetShadowBuffer) 三种发送方式下
+// 虚拟 SSD1306 上的总线字节数 / 传输次数, 并校验显存与缓冲区一致;
+// 脏 tile 发送逐帧校验写入显存的字节数
+#include "sim_ssd1306.h"
+#include "u8g2.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define BENCH_FRAMES 120
+#define BENCH_I2C_HZ 400000.0
+
+typedef void (*bench_draw_t)(u8g2_t *u8g2, int frame);
+typedef void (*bench_setup_t)(u8g2_t *u8g2, const u8g2_cb_t *rotation,
+                              u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_cb);
+
+// 类似 VList 的菜单: 选择框逐帧移动
+static void bench_draw_menu(u8g2_t *u8g2, int frame) {
+  static const char *items[] = {"System Config", "Brightness", "Mute Mode",
+                                "Bluetooth", "Oscilloscope"};
+  u8g2_SetFont(u8g2, u8g2_font_6x10_tf);
+  for (int i = 0; i < 5; i++) u8g2_DrawStr(u8g2, 4, 12 + i * 12, items[i]);
+  u8g2_SetDrawColor(u8g2, 2);
+  u8g2_DrawBox(u8g2, 0, 2 + (frame % 60), 128, 12);
+  u8g2_SetDrawColor(u8g2, 1);
+}
+
+// 整屏不变
+static void bench_draw_static(u8g2_t *u8g2, int frame) {
+  u8g2_SetFont(u8g2, u8g2_font_6x10_tf);
+  u8g2_DrawStr(u8g2, 2, 12, "STATIC SCREEN");
+  u8g2_DrawFrame(u8g2, 0, 16, 128, 48);
+}
+
+// 类似示波器的波形
+static void bench_draw_wave(u8g2_t *u8g2, int frame) {
+  u8g2_SetFont(u8g2, u8g2_font_6x10_tf);
+  u8g2_DrawStr(u8g2, 2, 12, "OSCILLOSCOPE");
+  u8g2_DrawHLine(u8g2, 0, 15, 128);
+  for (int x = 0; x < 128; x++)
+    u8g2_DrawPixel(u8g2, x, 40 + (int)(sin((x + frame) * 0.15f) * 15));
+}
+
+static const struct {
+  const char *name;
+  bench_draw_t draw;
+} bench_scenes[] = {
+    {"menu", bench_draw_menu},
+    {"static", bench_draw_static},
+    {"wave", bench_draw_wave},
+};
+
+// 发送方式, 与 page_stack.h 的 PAGE_SEND_* 对应
+enum { BENCH_SEND_FULL, BENCH_SEND_DIRTY, BENCH_SEND_DIFF, BENCH_SEND_MODES };
+static const char *bench_send_names[BENCH_SEND_MODES] = {"full", "dirty", "diff"};
+
+static const struct {
+  const char *name;
+  bench_setup_t setup;
+} bench_drivers[] = {
+    {"noname", u8g2_Setup_ssd1306_i2c_128x64_noname_f},
+    {"stream", u8g2_Setup_ssd1306_i2c_128x64_stream_f},
+};
+
+// 脏 tile 发送的逐帧检查: 本帧与上一帧绘制过的 tile 各写入显存 8 字节, 且包含所有内容改变的 tile
+static unsigned long g_dirty_frames, g_dirty_bad;
+
+static int bench_tile_bit(const uint8_t *bits, int idx) { return (bits[idx >> 3] >> (idx & 7)) & 1; }
+
+// 发送前调用, 返回应写入显存的数据字节数; 内容改变却未标记的 tile 计入 g_dirty_bad
+static unsigned long bench_dirty_expect(u8g2_t *u8g2, const uint8_t *prev) {
+  const uint8_t (*ram)[SIM_SSD1306_COLS] = sim_ssd1306_gddram();
+  const uint8_t *buf = u8g2_GetBufferPtr(u8g2);
+  unsigned long bytes = 0;
+
+  for (int idx = 0; idx < SIM_SSD1306_PAGES * SIM_SSD1306_COLS / 8; idx++) {
+    int page = idx / (SIM_SSD1306_COLS / 8), col = idx % (SIM_SSD1306_COLS / 8) * 8;
+    if (bench_tile_bit(u8g2->tile_dirty, idx) || bench_tile_bit(prev, idx))
+      bytes += 8;
+    else if (memcmp(ram[page] + col, buf + page * SIM_SSD1306_COLS + col, 8) != 0)
+      g_dirty_bad++;
+  }
+  return bytes;
+}
+
+// 运行一个场景, 返回不一致帧数
+static int bench_run(bench_setup_t setup, bench_draw_t draw, int send,
+                     sim_ssd1306_stat_t *stat) {
+  static uint8_t shadow[128 * 64 / 8];
+  uint8_t prev[sizeof(((u8g2_t *)0)->tile_dirty)] = {0}; // 上一帧绘制过的 tile, 清屏后为空
+  u8g2_t u8g2;
+  int bad = 0;
+
+  sim_ssd1306_reset();
+  setup(&u8g2, U8G2_R0, u8x8_byte_sim_ssd1306, u8x8_gpio_and_delay_sim);
+  u8g2_InitDisplay(&u8g2);
+  u8g2_SetPowerSave(&u8g2, 0);
+  u8g2_ClearBuffer(&u8g2);
+  u8g2_SendBuffer(&u8g2);
+  // 会清屏, 使影子缓冲与显存一致
+  if (send == BENCH_SEND_DIFF) u8g2_SetShadowBuffer(&u8g2, shadow);
+  sim_ssd1306_clear_stat();
+
+  for (int frame = 0; frame < BENCH_FRAMES; frame++) {
+    u8g2_ClearBuffer(&u8g2);
+    draw(&u8g2, frame);
+    if (send == BENCH_SEND_DIRTY) {
+      unsigned long expect = bench_dirty_expect(&u8g2, prev);
+      unsigned long data = sim_ssd1306_get_stat().data;
+      u8g2_SendDirtyBuffer(&u8g2);
+      if (sim_ssd1306_get_stat().data - data != expect) g_dirty_bad++;
+      memcpy(prev, u8g2.tile_dirty, sizeof(prev));
+      g_dirty_frames++;
+    } else
+      u8g2_SendBuffer(&u8g2);
+    if (sim_ssd1306_compare(&u8g2) != 0) bad++;
+  }
+  *stat = sim_ssd1306_get_stat();
+  return bad;
+}
+
+int main(void) {
+  int bad = 0;
+
+  printf("%-7s %-6s %-6s %10s %10s %10s\n", "scene", "send", "driver",
+         "bytes/f", "xfers/f", "ms/f@400k");
+  for (size_t s = 0; s < sizeof(bench_scenes) / sizeof(bench_scenes[0]); s++) {
+    for (int send = 0; send < BENCH_SEND_MODES; send++) {
+      for (size_t d = 0; d < sizeof(bench_drivers) / sizeof(bench_drivers[0]); d++) {
+        sim_ssd1306_stat_t stat;
+        bad += bench_run(bench_drivers[d].setup, bench_scenes[s].draw, send, &stat);
+        // 每字节 9 个时钟 (含 ACK), 每次传输额外计 2 个时钟 (START/STOP)
+        double bits = stat.bytes * 9.0 + stat.transfers * 2.0;
+        printf("%-7s %-6s %-6s %10.1f %10.1f %10.2f\n", bench_scenes[s].name,
+               bench_send_names[send], bench_drivers[d].name,
+               (double)stat.bytes / BENCH_FRAMES,
+               (double)stat.transfers / BENCH_FRAMES,
+               bits / BENCH_I2C_HZ * 1000.0 / BENCH_FRAMES);
+      }
+    }
+  }
+  printf("dirty send: %lu frames, %lu with wrong data bytes or unsent changed tiles\n",
+         g_dirty_frames, g_dirty_bad);
+  if (bad) printf("ERROR: %d frames differ from the frame buffer\n", bad);
+  return bad != 0 || g_dirty_bad != 0;
+}
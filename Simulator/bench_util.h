@@ -0,0 +1,64 @@
+#ifndef __BENCH_UTIL_H__
+#define __BENCH_UTIL_H__
+
+// 主机端 bench_* 共用的计时、伪随机数与缓冲区校验值,
+// 以及 bench_box / bench_xbm 使用的随机裁剪窗口校验循环
+#include "u8g2.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+// 校验循环的轮数
+#define BENCH_CHECK_ROUNDS 3000
+
+// 单调时钟 (秒)
+static inline double bench_sec(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// 线性同余伪随机数, 固定种子, 每个测试程序的序列相同
+static inline uint32_t bench_rand(void) {
+  static uint32_t seed = 12345;
+  seed = seed * 1103515245u + 12345u;
+  return seed >> 8;
+}
+
+// 把全缓冲与脏 tile 标记计入校验值, 优化前后两者都应一致
+static inline unsigned long bench_hash(u8g2_t *u8g2, unsigned long hash) {
+  const uint8_t *buf = u8g2_GetBufferPtr(u8g2);
+  for (int i = 0; i < 1024; i++) hash = (hash * 31 + buf[i]) & 0xffffffffUL;
+#ifdef U8G2_WITH_DIRTY_TILES
+  for (size_t i = 0; i < sizeof(u8g2->tile_dirty); i++)
+    hash = (hash * 31 + u8g2->tile_dirty[i]) & 0xffffffffUL;
+#endif
+  return hash;
+}
+
+// 校验循环中每轮的绘制, r 为轮数
+typedef void (*bench_check_draw_t)(u8g2_t *u8g2, int r);
+
+// 校验循环: 每轮清空缓冲区, 奇数轮先绘制背景, 每 4 轮中有 2 轮使用随机裁剪窗口,
+// 之后调用 draw 并把结果计入校验值; 结束后恢复裁剪窗口与颜色
+static inline unsigned long bench_check_loop(u8g2_t *u8g2, bench_check_draw_t background,
+                                             bench_check_draw_t draw) {
+  unsigned long hash = 0;
+
+  for (int r = 0; r < BENCH_CHECK_ROUNDS; r++) {
+    u8g2_ClearBuffer(u8g2);
+    if (r & 1) background(u8g2, r);
+    if (r & 2)
+      u8g2_SetClipWindow(u8g2, bench_rand() % 60, bench_rand() % 30, 60 + bench_rand() % 68,
+                         30 + bench_rand() % 34);
+    else
+      u8g2_SetMaxClipWindow(u8g2);
+    draw(u8g2, r);
+    hash = bench_hash(u8g2, hash);
+  }
+  u8g2_SetMaxClipWindow(u8g2);
+  u8g2_SetDrawColor(u8g2, 1);
+  return hash;
+}
+
+#endif
@@ -0,0 +1,155 @@
+// 虚拟列表性能测试: 行数 16 ~ 40000 的列表在开头/中间/末尾上下滚动, 统计 vlist_draw 每帧耗时
+// 与 provider 调用次数; 耗时应与行数无关. 同时校验虚拟列表与相同内容的普通列表绘制结果一致.
+// 以 -DVLIST_LAYOUT_SLOTS=0 编译得到没有行布局缓存的对照结果 (make bench-vlist 会同时运行两者),
+// 两次运行的校验值应相同. 另外校验 32768 行之后的滚动位置与短列表末尾相同
+#include "bench_util.h"
+#include "VList.h"
+#include "sim_ssd1306.h"
+#include <stdio.h>
+#include <string.h>
+
+#define BENCH_STEPS 40      // 每个位置的按键次数
+#define BENCH_STEP_FRAMES 8 // 每次按键后的帧数 (含动画)
+#define BENCH_VALUES 64     // 数值行共用的数值
+
+u8g2_t u8g2;
+const Screen_t g_screen_cfg = DEFAULT_SCREEN_CONFIG;
+
+static uint32_t g_tick;
+static unsigned long g_provider_calls;
+static float g_values[BENCH_VALUES];
+
+// 第 index 行的内容; mixed 时每 3 行中有一个数值行和一个子菜单行
+static void bench_fill(uint16_t index, bool mixed, vitem_t *item, char *buf, uint8_t buf_size) {
+  snprintf(buf, buf_size, "Channel %05u", (unsigned)index);
+  item->title = buf;
+  item->type = VITEM_PLAIN_TEXT;
+  if (mixed && index % 3 == 1) {
+    item->type = VITEM_NUM_EDIT;
+    item->user_data = &g_values[index % BENCH_VALUES];
+  } else if (mixed && index % 3 == 2) {
+    item->type = VITEM_SUBMENU;
+  }
+}
+
+static void bench_provider(void *ctx, uint16_t index, vitem_t *item, char *buf, uint8_t buf_size) {
+  g_provider_calls++;
+  bench_fill(index, ctx != NULL, item, buf, buf_size);
+}
+
+// 按到末尾的距离命名的行, ctx 为行数; 长短两个列表末尾的内容相同
+static void bench_provider_tail(void *ctx, uint16_t index, vitem_t *item, char *buf, uint8_t buf_size) {
+  snprintf(buf, buf_size, "Row -%u", (unsigned)(*(uint16_t *)ctx - 1 - index));
+  item->title = buf;
+  item->type = VITEM_PLAIN_TEXT;
+}
+
+// 从 pos 开始按下/上键滚动, 每次按键修改一个数值; 返回 vlist_draw 的总耗时, hash 为每帧缓冲区的校验值
+// (no_bar 时不含长度与行数有关的滚动条)
+static double bench_scroll(vlist_t *list, int pos, bool no_bar, unsigned long *frames, unsigned long *hash) {
+  double sec = 0;
+
+  list->from_index = list->to_index = pos;
+  for (int s = 0; s < BENCH_STEPS; s++) {
+    // 前一半向下, 后一半向上 (在末尾时先向上)
+    bool down = (s < BENCH_STEPS / 2) == (pos < list->count / 2 + 1);
+    VLIST_COMP.input(down ? BTN_DOWN : BTN_UP, list);
+    g_values[(list->to_index + 3) % BENCH_VALUES] += 0.5f;
+    for (int f = 0; f < BENCH_STEP_FRAMES; f++) {
+      u8g2_ClearBuffer(&u8g2);
+      double t0 = bench_sec();
+      VLIST_COMP.draw(&u8g2, list);
+      sec += bench_sec() - t0;
+      g_tick += PAGE_FRAME_MS;
+      (*frames)++;
+      if (no_bar) {
+        u8g2_SetDrawColor(&u8g2, 0);
+        u8g2_DrawVLine(&u8g2, g_screen_cfg.width - 1, 0, g_screen_cfg.height);
+        u8g2_SetDrawColor(&u8g2, 1);
+      }
+      *hash = bench_hash(&u8g2, *hash);
+    }
+  }
+  return sec;
+}
+
+// 虚拟列表与内容相同的普通列表逐帧比较
+static int bench_check(void) {
+  static vlist_t plain, virt;
+  static vitem_t items[MAX_LIST_ITEMS];
+  static char titles[MAX_LIST_ITEMS][VLIST_ROW_TEXT_LEN];
+  unsigned long f0 = 0, f1 = 0, h0 = 0, h1 = 0;
+
+  vlist_init(&plain, &g_tick);
+  for (int i = 0; i < MAX_LIST_ITEMS; i++) {
+    bench_fill(i, true, &items[i], titles[i], sizeof(titles[i]));
+    plain.items[plain.count++] = items[i];
+  }
+  vlist_init_provider(&virt, &g_tick, MAX_LIST_ITEMS, bench_provider, (void *)1);
+  // 滚动文本与动画取决于时钟, 数值每次按键都会修改, 两者从相同的状态开始
+  for (int pos = 0; pos < MAX_LIST_ITEMS; pos += 5) {
+    uint32_t tick = g_tick;
+    float values[BENCH_VALUES];
+    memcpy(values, g_values, sizeof(values));
+    bench_scroll(&plain, pos, false, &f0, &h0);
+    g_tick = tick;
+    memcpy(g_values, values, sizeof(values));
+    bench_scroll(&virt, pos, false, &f1, &h1);
+  }
+  printf("check: plain %08lx virtual %08lx%s\n", h0, h1, h0 == h1 ? "" : "  MISMATCH");
+  return h0 != h1;
+}
+
+// 40000 行列表末尾与 100 行列表末尾逐帧比较: 行号超过 32767 时高亮框与滚动偏移不能溢出
+static int bench_check_tail(void) {
+  static vlist_t list;
+  static uint16_t counts[2] = {100, 40000};
+  unsigned long hash[2] = {0, 0}, frames = 0;
+  uint32_t tick = g_tick;
+
+  for (int k = 0; k < 2; k++) {
+    g_tick = tick;
+    vlist_init_provider(&list, &g_tick, counts[k], bench_provider_tail, &counts[k]);
+    bench_scroll(&list, counts[k] - 1, true, &frames, &hash[k]);
+  }
+  printf("tail:  %u rows %08lx, %u rows %08lx%s\n", counts[0], hash[0], counts[1], hash[1],
+         hash[0] == hash[1] ? "" : "  MISMATCH");
+  return hash[0] != hash[1];
+}
+
+static void bench_table(const char *name, void *mixed) {
+  static const uint16_t counts[] = {MAX_LIST_ITEMS, 100, 1000, 10000, 40000};
+  static vlist_t list;
+
+  printf("%s, vlist_draw per frame (%d frames per position):\n", name,
+         BENCH_STEPS * BENCH_STEP_FRAMES);
+  for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+    uint16_t n = counts[c];
+    int pos[3] = {0, n / 2, n - 1};
+
+    vlist_init_provider(&list, &g_tick, n, bench_provider, mixed);
+    printf("  %5u rows:", n);
+    for (int k = 0; k < 3; k++) {
+      unsigned long frames = 0, hash = 0;
+      g_provider_calls = 0;
+      double sec = bench_scroll(&list, pos[k], false, &frames, &hash);
+      printf("  @%-5d %5.2f us %4.2f fetch", pos[k], sec * 1e6 / frames,
+             (double)g_provider_calls / frames);
+    }
+    putchar('\n');
+  }
+}
+
+int main(void) {
+  int bad;
+
+  u8g2_Setup_ssd1306_i2c_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_sim_ssd1306,
+                                        u8x8_gpio_and_delay_sim);
+  u8g2_InitDisplay(&u8g2);
+  printf("layout cache: %d slots\n", VLIST_LAYOUT_SLOTS);
+  bad = bench_check();
+  bad |= bench_check_tail();
+  bench_table("text rows", NULL);
+  bench_table("mixed rows (1/3 numbers)", (void *)1);
+  return bad;
+}
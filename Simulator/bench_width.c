@@ -0,0 +1,91 @@
+// 字符串宽度测量开销: 运行 ui_sim 的默认脚本, 统计每帧测量字符串宽度的次数与耗时
+// 以 -DSTR_WIDTH_CACHE_SIZE=0 编译得到对照结果 (make bench-width 会同时运行两者)
+// 链接时以 --wrap 包装 str_width_get 与 u8g2_GetStrWidth, 组件代码不需要修改
+#include "bench_util.h"
+#include "page_stack.h"
+#include "sim_demo.h"
+#include "sim_ssd1306.h"
+#include "str_width.h"
+#include <stdio.h>
+
+#define BENCH_REPEAT 20
+
+extern u8g2_t u8g2;
+static uint32_t g_sim_clock_ms;
+
+static struct {
+  unsigned long calls;      // 组件的测量次数 (str_width_get 与直接调用的 u8g2_GetStrWidth)
+  unsigned long u8g2_calls; // 实际调用 u8g2_GetStrWidth 的次数
+  double sec;               // 测量耗时 (已扣除计时本身的开销)
+  int depth;                // str_width_get 内部的调用不重复计时
+} g_bench;
+static double g_timer_cost;
+
+u8g2_uint_t __real_str_width_get(u8g2_t *u8g2, const char *str);
+u8g2_uint_t __real_u8g2_GetStrWidth(u8g2_t *u8g2, const char *s);
+
+static uint32_t sim_clock(void) { return g_sim_clock_ms; }
+
+u8g2_uint_t __wrap_str_width_get(u8g2_t *u8g2, const char *str) {
+  double t0 = bench_sec();
+  g_bench.depth++;
+  u8g2_uint_t w = __real_str_width_get(u8g2, str);
+  g_bench.depth--;
+  g_bench.sec += bench_sec() - t0 - g_timer_cost;
+  g_bench.calls++;
+  return w;
+}
+
+u8g2_uint_t __wrap_u8g2_GetStrWidth(u8g2_t *u8g2, const char *s) {
+  g_bench.u8g2_calls++;
+  if (g_bench.depth > 0) return __real_u8g2_GetStrWidth(u8g2, s);
+
+  double t0 = bench_sec();
+  u8g2_uint_t w = __real_u8g2_GetStrWidth(u8g2, s);
+  g_bench.sec += bench_sec() - t0 - g_timer_cost;
+  g_bench.calls++;
+  return w;
+}
+
+// 两次读取时钟的平均耗时
+static double bench_timer_cost(void) {
+  const int n = 100000;
+  double sum = 0;
+  for (int i = 0; i < n; i++) {
+    double t0 = bench_sec();
+    sum += bench_sec() - t0;
+  }
+  return sum / n;
+}
+
+int main(void) {
+  unsigned long rendered = 0;
+
+  g_timer_cost = bench_timer_cost();
+  sim_ssd1306_reset();
+  u8g2_Setup_ssd1306_i2c_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_sim_ssd1306,
+                                        u8x8_gpio_and_delay_sim);
+  u8g2_InitDisplay(&u8g2);
+  btn_fifo_init();
+  page_stack_init(&g_page_stack, &u8g2);
+  page_stack_register_clock_cb(&g_page_stack, sim_clock);
+  sim_demo_init();
+
+  for (int r = 0; r < BENCH_REPEAT; r++) {
+    for (const char *p = SIM_DEMO_SCRIPT; *p; p++) {
+      btn_type_t key = sim_demo_key_to_btn(*p);
+      if (key != BTN_NONE) btn_fifo_push(key);
+      for (int f = 0; f < SIM_DEMO_FRAMES_PER_KEY; f++) {
+        if (page_update(&g_page_stack, btn_fifo_pop())) rendered++;
+        g_sim_clock_ms += PAGE_FRAME_MS;
+      }
+    }
+  }
+
+  printf("str width cache: %d entries\n", STR_WIDTH_CACHE_SIZE);
+  if (rendered == 0) return 1;
+  printf("  %lu frames, %.1f measurements/frame, %.1f u8g2_GetStrWidth/frame\n", rendered,
+         (double)g_bench.calls / rendered, (double)g_bench.u8g2_calls / rendered);
+  printf("  measurement cost %.2f us/frame\n", g_bench.sec * 1e6 / rendered);
+  return 0;
+}
@@ -0,0 +1,73 @@
+// XBM 位图绘制性能测试: 按图标的用法绘制 32x32 位图, 统计 y 按页对齐/不对齐时 u8g2_DrawXBM 的耗时.
+// 以 -DU8G2_WITHOUT_XBM_BLIT 编译得到按 hvline 绘制的对照结果 (make bench-xbm 会同时运行两者),
+// 两次运行的校验值 (含脏 tile 标记) 应相同
+#include "bench_util.h"
+#include "sim_ssd1306.h"
+#include "u8g2.h"
+#include <stdio.h>
+
+#define BENCH_ROUNDS 20000
+
+// 校验用的位图尺寸 (宽, 高), 第一个与图标相同
+static const uint8_t bench_sizes[][2] = {{32, 32}, {13, 7}, {40, 21}, {8, 8}, {70, 3}, {1, 17}};
+#define BENCH_SIZE_NUM (sizeof(bench_sizes) / sizeof(bench_sizes[0]))
+
+static uint8_t g_bench_xbm[BENCH_SIZE_NUM][10 * 32];
+
+static void bench_check_background(u8g2_t *u8g2, int r) { u8g2_DrawBox(u8g2, 20, 6, 70, 40); }
+
+static void bench_check_draw(u8g2_t *u8g2, int r) {
+  u8g2_SetBitmapMode(u8g2, (r >> 2) & 1);
+  for (int k = 0; k < 8; k++) {
+    size_t n = bench_rand() % BENCH_SIZE_NUM;
+    u8g2_SetDrawColor(u8g2, (uint8_t)(bench_rand() % 3));
+    u8g2_DrawXBM(u8g2, (u8g2_uint_t)((int)(bench_rand() % 200) - 70),
+                 (u8g2_uint_t)((int)(bench_rand() % 120) - 40), bench_sizes[n][0],
+                 bench_sizes[n][1], g_bench_xbm[n]);
+  }
+}
+
+// 校验: 各种尺寸、位置 (跨页, 超出屏幕与 u8g2_uint_t 回绕的坐标)、颜色、位图模式与裁剪窗口
+static unsigned long bench_check(u8g2_t *u8g2) {
+  unsigned long hash = bench_check_loop(u8g2, bench_check_background, bench_check_draw);
+  u8g2_SetBitmapMode(u8g2, 0);
+  return hash;
+}
+
+// 在 y 处横向绘制 4 个图标, 返回每次 u8g2_DrawXBM 的耗时 (ns)
+static double bench_icons(u8g2_t *u8g2, int y, uint8_t mode) {
+  double t0, sec = 0;
+  u8g2_SetBitmapMode(u8g2, mode);
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    u8g2_ClearBuffer(u8g2);
+    t0 = bench_sec();
+    for (int i = 0; i < 4; i++)
+      u8g2_DrawXBM(u8g2, (u8g2_uint_t)(i * 34 + r % 7 - 3), (u8g2_uint_t)y, 32, 32,
+                   g_bench_xbm[0]);
+    sec += bench_sec() - t0;
+  }
+  u8g2_SetBitmapMode(u8g2, 0);
+  return sec * 1e9 / (BENCH_ROUNDS * 4.0);
+}
+
+int main(void) {
+  u8g2_t u8g2;
+
+  for (size_t n = 0; n < BENCH_SIZE_NUM; n++)
+    for (size_t i = 0; i < sizeof(g_bench_xbm[n]); i++) g_bench_xbm[n][i] = (uint8_t)bench_rand();
+
+  u8g2_Setup_ssd1306_i2c_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_sim_ssd1306,
+                                        u8x8_gpio_and_delay_sim);
+  u8g2_InitDisplay(&u8g2);
+#ifdef U8G2_WITH_XBM_BLIT
+  printf("xbm blit: on\n");
+#else
+  printf("xbm blit: off\n");
+#endif
+  printf("  check %08lx\n", bench_check(&u8g2));
+  printf("  32x32 solid       y=16 %8.1f ns/call, y=13 %8.1f ns/call\n",
+         bench_icons(&u8g2, 16, 0), bench_icons(&u8g2, 13, 0));
+  printf("  32x32 transparent y=16 %8.1f ns/call, y=13 %8.1f ns/call\n",
+         bench_icons(&u8g2, 16, 1), bench_icons(&u8g2, 13, 1));
+  return 0;
+}
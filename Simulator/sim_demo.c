@@ -0,0 +1,207 @@
+// 与 User/main.c 相同的演示界面, 去掉了串口/延时等硬件相关部分
+#include "sim_demo.h"
+#include "HList.h"
+#include "VList.h"
+#include "brick_break.h"
+#include "page_prof.h"
+#include "page_stack.h"
+#include "portal_component.h"
+#include "screen.h"
+#include "splash_screen.h"
+#include <math.h>
+#include <stdio.h>
+
+#define ICON_SETTINGS 0x0081 // 设置图标
+#define ICON_ABOUT 0x0114    // 关于图标
+#define ICON_LOCK 0x0057     // 叉叉图标
+#define ICON_UNLOCK 0x0078   // 对勾图标
+
+const Screen_t g_screen_cfg = DEFAULT_SCREEN_CONFIG;
+u8g2_t u8g2;
+
+static hlist_t g_main_hlist;
+static vlist_t g_setting_main_menu;
+static vlist_t g_setting_sub_menu;
+static vlist_t g_about_menu;
+static vlist_t g_channel_menu;
+static brick_break_ctx_t g_brick_break_ctx;
+
+static bool g_wifi_state = false;
+static bool g_bt_state = true;
+static bool g_mute_mode = false;
+static float g_screen_brightness = 50.0f;
+static float g_backlight_timeout = 30.0f;
+static float test_num = 0;
+
+// User/ui.c 中 icon_list[3] (示波器图标)
+static const uint8_t sim_icon_osc[128] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,
+    0x00,0x38,0x10,0x00,0x00,0x42,0x10,0x00,0x00,0x42,0x10,0x00,0x00,0xF2,0x17,0x00,
+    0x00,0x42,0x0C,0x00,0x00,0x42,0x00,0x00,0x00,0x42,0xF0,0x00,0x00,0xC0,0x0F,0x00,
+    0x00,0xFF,0x7F,0x00,0x00,0x1C,0x02,0x00,0xE0,0x07,0x02,0x00,0x00,0x02,0x02,0x00,
+    0x00,0x02,0x02,0x00,0x00,0x02,0x02,0x00,0x00,0x02,0x02,0x00,0x00,0x02,0x02,0x00,
+    0x00,0x03,0x02,0x00,0x00,0x01,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+static void sim_splash_draw(u8g2_t *u8g2, const Screen_t *screen_cfg) {
+  u8g2_SetFont(u8g2, u8g2_font_6x10_tf);
+  u8g2_DrawFrame(u8g2, screen_cfg->width - 20, 2, 18, 10);
+  u8g2_DrawBox(u8g2, screen_cfg->width - 18, 4, 14, 6);
+  u8g2_DrawStr(u8g2, screen_cfg->width - 40, 10, "80%");
+
+  uint8_t hour = 12, min = 30, sec = (g_page_stack.main_tick / 1000) % 60;
+  page_stack_request_frame(&g_page_stack);
+  char time_str[10];
+  sprintf(time_str, "%02d:%02d:%02d", hour, min, sec);
+  u8g2_SetFont(u8g2, u8g2_font_logisoso20_tn);
+  int time_width = u8g2_GetStrWidth(u8g2, time_str);
+  u8g2_DrawStr(u8g2, (screen_cfg->width - time_width) / 2,
+               screen_cfg->height / 2 + 10, time_str);
+
+  u8g2_SetFont(u8g2, u8g2_font_5x7_tf);
+  const char *hint = "Press any btn to enter";
+  u8g2_DrawStr(u8g2, (screen_cfg->width - str_width_get(u8g2, hint)) / 2,
+               screen_cfg->height - 5, hint);
+}
+
+static void sim_global_btn_handler(btn_type_t btn) {
+  if (btn == BTN_LONG_PRESS) {
+    splash_screen_jump();
+  }
+}
+
+static void sim_osc_draw(u8g2_t *u8g2, void *ctx) {
+  uint8_t wave_offset = (g_page_stack.main_tick / 20) % 255;
+  page_stack_request_frame(&g_page_stack);
+
+  u8g2_SetFont(u8g2, u8g2_font_6x10_tf);
+  u8g2_DrawStr(u8g2, 2, 12, "OSCILLOSCOPE");
+  u8g2_DrawHLine(u8g2, 0, 15, 128);
+
+  for (uint8_t x = 0; x < 128; x++) {
+#if UI_FIXED_MATH
+    uint8_t y = fix_to_int(Q16(40) + fix_sin((x + wave_offset) * Q16(0.15f)) * 15);
+#else
+    uint8_t y = 40 + (sin((x + wave_offset) * 0.15f) * 15);
+#endif
+    u8g2_DrawPixel(u8g2, x, y);
+  }
+  u8g2_DrawStr(u8g2, 10, 62, "BACK:Exit  LONG:Home");
+}
+
+static void sim_osc_input(int btn, void *ctx) {
+  if (btn == BTN_BACK) {
+    page_stack_pop(&g_page_stack);
+  }
+}
+
+static const page_component_t SIM_OSC_COMP = {.draw = sim_osc_draw,
+                                              .input = sim_osc_input,
+                                              .multi_step = false};
+
+// ===================== 虚拟列表 =====================
+#define CHANNEL_NUM 256
+// 通道列表的行在显示时才生成, 不占用 items
+static void channel_provider(void *ctx, uint16_t index, vitem_t *item, char *buf,
+                             uint8_t buf_size) {
+  snprintf(buf, buf_size, "Channel %03u", (unsigned)index);
+  item->title = buf;
+  item->type = VITEM_PLAIN_TEXT;
+}
+
+// 没有延时, 只输出进度
+static void sim_long_task(void *ctx) {
+  Progress_Log(ctx, "Initializing...");
+  Progress_Log(ctx, "Erasing...");
+  for (int i = 0; i <= 100; i += 20) {
+    Progress_Log(ctx, "Writing: %d%%", i);
+  }
+  Progress_SetFailed(ctx, "no idea");
+}
+
+void sim_demo_init(void) {
+  vlist_init(&g_setting_main_menu, &g_page_stack.main_tick);
+  vlist_init(&g_setting_sub_menu, &g_page_stack.main_tick);
+  vlist_init(&g_about_menu, &g_page_stack.main_tick);
+  vlist_init_provider(&g_channel_menu, &g_page_stack.main_tick, CHANNEL_NUM,
+                      channel_provider, NULL);
+  hlist_init(&g_main_hlist, &g_page_stack.main_tick);
+  brick_break_init(&g_brick_break_ctx, &g_page_stack.main_tick, &g_screen_cfg);
+
+  vlist_add_toggle(&g_setting_sub_menu, "WIFI Link", &g_wifi_state);
+  vlist_add_num(&g_setting_sub_menu, "Brightness", &g_screen_brightness, 0, 100,
+                5);
+  // 标题超出 portal 宽度, 打开后滚动 (sim-portal)
+  vlist_add_num(&g_setting_sub_menu, "Backlight timeout in seconds", &g_backlight_timeout, 0, 600,
+                10);
+  vlist_add_submenu(&g_setting_main_menu, "System Config", &g_setting_sub_menu);
+  vlist_add_precise_num(&g_setting_main_menu, "Precise Num Test", &test_num,
+                        -100, 200, 3, 0);
+  vlist_add_protected_progress(&g_setting_main_menu, "Save Config", sim_long_task);
+  vlist_add_toggle(&g_setting_main_menu, "Mute Mode", &g_mute_mode);
+  vlist_add_toggle(&g_setting_main_menu, "Bluetooth", &g_bt_state);
+  vlist_add_protected_submenu(&g_setting_main_menu, "Protect.false",
+                              &g_setting_sub_menu, false, "warinng",
+                              "Try Again!");
+  vlist_add_protected_submenu(&g_setting_main_menu, "Protect.true",
+                              &g_setting_sub_menu, true, "warinng",
+                              "Try Again!");
+  vlist_add_action(&g_setting_main_menu, "Oscilloscope", &SIM_OSC_COMP, NULL);
+  vlist_add_action(&g_setting_main_menu, "Brick Break", &BRICK_BREAK_COMP,
+                   &g_brick_break_ctx);
+  vlist_add_protected_action(&g_setting_main_menu, "Brick Break (locked)",
+                             &BRICK_BREAK_COMP, &g_brick_break_ctx, false,
+                             "warinng", "This action is locked!");
+  vlist_add_protected_action(&g_setting_main_menu, "Brick Break (unlocked)",
+                             &BRICK_BREAK_COMP, &g_brick_break_ctx, true,
+                             "warinng", "This action is locked!");
+  vlist_add_submenu(&g_setting_main_menu, "Channels", &g_channel_menu);
+
+  vlist_add_plain_text(&g_about_menu, "Version: 0.0.1");
+  vlist_add_plain_text(&g_about_menu, "Author: dggdoo");
+  vlist_add_plain_text(&g_about_menu, "Build: 2026-01");
+
+  hlist_add_glyph_item(&g_main_hlist, "SETTINGS", ICON_SETTINGS, &VLIST_COMP,
+                       &g_setting_main_menu);
+  hlist_add_xbm_item(&g_main_hlist, "OSCILLO", sim_icon_osc, &SIM_OSC_COMP,
+                     NULL);
+  hlist_add_glyph_item(&g_main_hlist, "BRICK GAME", ICON_ABOUT,
+                       &BRICK_BREAK_COMP, &g_brick_break_ctx);
+  hlist_add_glyph_item(&g_main_hlist, "ABOUT", ICON_ABOUT, &VLIST_COMP,
+                       &g_about_menu);
+  hlist_add_protected_glyph_item(&g_main_hlist, "Protected.false", ICON_LOCK,
+                                 &VLIST_COMP, &g_about_menu, false,
+                                 "Try Again!");
+  hlist_add_protected_glyph_item(&g_main_hlist, "Protected.true", ICON_UNLOCK,
+                                 &VLIST_COMP, &g_about_menu, true,
+                                 "Try Again!");
+
+  // 帧分段计时中的组件名
+  page_prof_set_name(&SPLASH_SCREEN_COMP, "splash");
+  page_prof_set_name(&HLIST_COMP, "hlist");
+  page_prof_set_name(&VLIST_COMP, "vlist");
+  page_prof_set_name(&SIM_OSC_COMP, "osc");
+  page_prof_set_name(&BRICK_BREAK_COMP, "brick");
+  page_prof_set_name(&PORTAL_MESSAGE_BOX, "msgbox");
+  page_prof_set_name(&PORTAL_NUM, "num");
+  page_prof_set_name(&PORTAL_PRECISE_NUM, "precise");
+
+  splash_screen_init(&g_main_hlist, sim_splash_draw);
+  page_stack_register_global_btn_cb(&g_page_stack, sim_global_btn_handler);
+  splash_screen_jump();
+}
+
+btn_type_t sim_demo_key_to_btn(char ch) {
+  switch (ch) {
+  case 'w': return BTN_UP;
+  case 's': return BTN_DOWN;
+  case 'a': return BTN_ENTER;
+  case 'd': return BTN_BACK;
+  case 'h': return BTN_LONG_PRESS;
+  case 'l': return BTN_LEFT;
+  case 'r': return BTN_RIGHT;
+  default: return BTN_NONE;
+  }
+}
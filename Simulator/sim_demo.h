@@ -0,0 +1,23 @@
+#ifndef __SIM_DEMO_H__
+#define __SIM_DEMO_H__
+
+#include "btn_fifo.h"
+#include "u8g2.h"
+
+// 默认脚本: 离开 splash, 浏览主菜单, 进入设置并滚动, 打开 portal, 返回
+#define SIM_DEMO_SCRIPT "a.rrrlll.a.ssssssssss..wwwww.a..a..ww.a.ww.a.ww.d..d.rrr.a.d.h.."
+#define SIM_DEMO_FRAMES_PER_KEY 16
+
+/**
+ * @brief 搭建与 User/main.c 相同的演示菜单, 并进入 SplashScreen
+ * @note  调用前需完成 page_stack_init
+ */
+void sim_demo_init(void);
+
+/**
+ * @brief 脚本字符转换为按键, 与 User/main.c 的串口按键映射一致
+ * @return '.' 及未知字符返回 BTN_NONE
+ */
+btn_type_t sim_demo_key_to_btn(char ch);
+
+#endif
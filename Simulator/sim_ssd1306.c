@@ -0,0 +1,202 @@
+#include "sim_ssd1306.h"
+#include <stdio.h>
+#include <string.h>
+
+// 虚拟 SSD1306: 只模拟与显存写入相关的命令
+typedef struct {
+  uint8_t gddram[SIM_SSD1306_PAGES][SIM_SSD1306_COLS];
+  uint8_t mode; // 0: 水平寻址 1: 垂直寻址 2: 页寻址
+  uint8_t col, page;
+  uint8_t col_start, col_end;
+  uint8_t page_start, page_end;
+  // 传输解析状态
+  uint8_t is_ctrl_received;
+  uint8_t is_data;
+  uint8_t cmd;
+  uint8_t arg_cnt; // 当前命令还需要的参数个数
+  uint8_t arg_idx;
+  uint8_t args[6];
+  // 当前传输的字节, 与 I2C DMA 字节层相同, END_TRANSFER 时才写到总线
+  uint8_t xfer[SIM_SSD1306_XFER_MAX];
+  uint16_t xfer_len;
+  sim_ssd1306_stat_t stat;
+} sim_ssd1306_t;
+
+static sim_ssd1306_t g_sim_ssd;
+
+// 带参数命令的参数个数
+static uint8_t sim_ssd1306_arg_cnt(uint8_t cmd) {
+  switch (cmd) {
+  case 0x20: case 0x81: case 0x8d: case 0xa8: case 0xd3:
+  case 0xd5: case 0xd9: case 0xda: case 0xdb:
+    return 1;
+  case 0x21: case 0x22: case 0xa3:
+    return 2;
+  case 0x29: case 0x2a:
+    return 5;
+  case 0x26: case 0x27:
+    return 6;
+  default:
+    return 0;
+  }
+}
+
+static void sim_ssd1306_exec(void) {
+  sim_ssd1306_t *s = &g_sim_ssd;
+  switch (s->cmd) {
+  case 0x20:
+    s->mode = s->args[0] & 3;
+    break;
+  case 0x21:
+    s->col_start = s->args[0] & 127;
+    s->col_end = s->args[1] & 127;
+    s->col = s->col_start;
+    break;
+  case 0x22:
+    s->page_start = s->args[0] & 7;
+    s->page_end = s->args[1] & 7;
+    s->page = s->page_start;
+    break;
+  }
+}
+
+static void sim_ssd1306_cmd_byte(uint8_t b) {
+  sim_ssd1306_t *s = &g_sim_ssd;
+  if (s->arg_cnt > 0) {
+    s->args[s->arg_idx++] = b;
+    if (--s->arg_cnt == 0) sim_ssd1306_exec();
+    return;
+  }
+  if (b < 0x10) { // 列地址低 4 位
+    s->col = (s->col & 0xf0) | b;
+  } else if (b < 0x20) { // 列地址高 4 位
+    s->col = (s->col & 0x0f) | ((b & 0x0f) << 4);
+  } else if (b >= 0xb0 && b <= 0xb7) { // 页地址
+    s->page = b & 7;
+  } else {
+    s->cmd = b;
+    s->arg_idx = 0;
+    s->arg_cnt = sim_ssd1306_arg_cnt(b);
+    if (s->arg_cnt == 0) sim_ssd1306_exec();
+  }
+}
+
+// 写显存并按寻址模式移动指针
+static void sim_ssd1306_data_byte(uint8_t b) {
+  sim_ssd1306_t *s = &g_sim_ssd;
+  s->gddram[s->page & 7][s->col & 127] = b;
+  s->stat.data++;
+  if (s->mode == 0) {
+    if (s->col >= s->col_end) {
+      s->col = s->col_start;
+      s->page = (s->page >= s->page_end) ? s->page_start : s->page + 1;
+    } else {
+      s->col++;
+    }
+  } else if (s->mode == 1) {
+    if (s->page >= s->page_end) {
+      s->page = s->page_start;
+      s->col = (s->col >= s->col_end) ? s->col_start : s->col + 1;
+    } else {
+      s->page++;
+    }
+  } else {
+    s->col = (s->col >= 127) ? 0 : s->col + 1;
+  }
+}
+
+void sim_ssd1306_reset(void) {
+  memset(&g_sim_ssd, 0, sizeof(g_sim_ssd));
+  g_sim_ssd.mode = 2;
+  g_sim_ssd.col_end = 127;
+  g_sim_ssd.page_end = 7;
+}
+
+// 把缓存的传输字节写到屏幕
+static void sim_ssd1306_flush(void) {
+  sim_ssd1306_t *s = &g_sim_ssd;
+  for (uint16_t i = 0; i < s->xfer_len; i++) {
+    uint8_t b = s->xfer[i];
+    if (!s->is_ctrl_received) {
+      // 控制字节: D/C# 位选择命令或数据
+      s->is_ctrl_received = 1;
+      s->is_data = (b & 0x40) != 0;
+    } else if (s->is_data) {
+      sim_ssd1306_data_byte(b);
+    } else {
+      sim_ssd1306_cmd_byte(b);
+    }
+  }
+  s->xfer_len = 0;
+}
+
+uint8_t u8x8_byte_sim_ssd1306(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
+                              void *arg_ptr) {
+  sim_ssd1306_t *s = &g_sim_ssd;
+  uint8_t *data = (uint8_t *)arg_ptr;
+
+  switch (msg) {
+  case U8X8_MSG_BYTE_START_TRANSFER:
+    s->is_ctrl_received = 0;
+    s->xfer_len = 0;
+    s->stat.transfers++;
+    s->stat.bytes++; // 地址字节
+    break;
+  case U8X8_MSG_BYTE_SEND:
+    while (arg_int-- > 0) {
+      if (s->xfer_len >= SIM_SSD1306_XFER_MAX) sim_ssd1306_flush(); // 超长的传输分段写入
+      s->xfer[s->xfer_len++] = *data++;
+      s->stat.bytes++;
+    }
+    break;
+  case U8X8_MSG_BYTE_END_TRANSFER:
+    sim_ssd1306_flush();
+    break;
+  case U8X8_MSG_BYTE_INIT:
+  case U8X8_MSG_BYTE_SET_DC:
+    break;
+  default:
+    return 0;
+  }
+  return 1;
+}
+
+uint8_t u8x8_gpio_and_delay_sim(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
+                                void *arg_ptr) {
+  return 1;
+}
+
+const uint8_t (*sim_ssd1306_gddram(void))[SIM_SSD1306_COLS] {
+  return (const uint8_t (*)[SIM_SSD1306_COLS])g_sim_ssd.gddram;
+}
+
+int sim_ssd1306_compare(u8g2_t *u8g2) {
+  const uint8_t *buf = u8g2_GetBufferPtr(u8g2);
+  int diff = 0;
+  for (int page = 0; page < SIM_SSD1306_PAGES; page++)
+    for (int col = 0; col < SIM_SSD1306_COLS; col++)
+      if (g_sim_ssd.gddram[page][col] != buf[page * SIM_SSD1306_COLS + col])
+        diff++;
+  return diff;
+}
+
+static FILE *g_sim_pbm_fp;
+
+static void sim_ssd1306_pbm_out(const char *s) { fputs(s, g_sim_pbm_fp); }
+
+int sim_ssd1306_save_pbm(const char *path) {
+  g_sim_pbm_fp = fopen(path, "w");
+  if (g_sim_pbm_fp == NULL) return -1;
+  // 显存按 [page][col] 排列, 与 u8g2 全缓冲的 tile 布局相同
+  u8x8_capture_write_pbm_pre(SIM_SSD1306_COLS / 8, SIM_SSD1306_PAGES, sim_ssd1306_pbm_out);
+  u8x8_capture_write_pbm_buffer(&g_sim_ssd.gddram[0][0], SIM_SSD1306_COLS / 8,
+                                SIM_SSD1306_PAGES, u8x8_capture_get_pixel_1,
+                                sim_ssd1306_pbm_out);
+  fclose(g_sim_pbm_fp);
+  g_sim_pbm_fp = NULL;
+  return 0;
+}
+
+sim_ssd1306_stat_t sim_ssd1306_get_stat(void) { return g_sim_ssd.stat; }
+
+void sim_ssd1306_clear_stat(void) { memset(&g_sim_ssd.stat, 0, sizeof(g_sim_ssd.stat)); }
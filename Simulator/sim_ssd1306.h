@@ -0,0 +1,59 @@
+#ifndef __SIM_SSD1306_H__
+#define __SIM_SSD1306_H__
+
+#include "u8g2.h"
+#include <stdint.h>
+
+#define SIM_SSD1306_COLS 128
+#define SIM_SSD1306_PAGES 8
+#define SIM_SSD1306_XFER_MAX 1100 // 缓存的单次传输字节数, 不小于整帧
+
+// 总线统计 (字节数包含每次传输的 I2C 地址字节)
+typedef struct {
+  unsigned long bytes;     // 总线字节数
+  unsigned long transfers; // I2C 传输次数 (START...STOP)
+  unsigned long data;      // 写入显存的数据字节数
+} sim_ssd1306_stat_t;
+
+/**
+ * @brief 复位虚拟屏幕 (显存清零, 页寻址模式, 统计清零)
+ */
+void sim_ssd1306_reset(void);
+
+/**
+ * @brief u8x8 字节层回调, 解析 SSD1306 I2C 命令/数据流并写入虚拟显存.
+ *        与硬件字节层相同, 一次传输的内容在 END_TRANSFER 时才生效
+ */
+uint8_t u8x8_byte_sim_ssd1306(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
+                              void *arg_ptr);
+
+/**
+ * @brief u8x8 GPIO/延时回调 (空实现)
+ */
+uint8_t u8x8_gpio_and_delay_sim(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
+                                void *arg_ptr);
+
+/**
+ * @brief 获取虚拟显存 [page][col]
+ */
+const uint8_t (*sim_ssd1306_gddram(void))[SIM_SSD1306_COLS];
+
+/**
+ * @brief 比较虚拟显存与 u8g2 全缓冲
+ * @return 不一致的字节数, 0 表示屏幕内容正确
+ */
+int sim_ssd1306_compare(u8g2_t *u8g2);
+
+/**
+ * @brief 将虚拟显存保存为 PBM 图片 (使用 u8x8_capture)
+ * @return 0 成功, -1 无法写入文件
+ */
+int sim_ssd1306_save_pbm(const char *path);
+
+/**
+ * @brief 获取 / 清零总线统计
+ */
+sim_ssd1306_stat_t sim_ssd1306_get_stat(void);
+void sim_ssd1306_clear_stat(void);
+
+#endif
@@ -0,0 +1,284 @@
+// 无头模拟器: 在虚拟 SSD1306 上运行 UI, 按脚本注入按键, 可逐帧导出 PBM
+// 时钟为模拟时钟, 每次调用 page_update 前进 PAGE_FRAME_MS, 结果与主机速度无关;
+// fps 按 page_update 实际耗时统计, 用于在主机上比较渲染性能; 输入延迟按模拟时钟统计
+// 以 CFLAGS=-DPAGE_PROF_ENABLE=1 编译时, 结束后输出 page_update 各阶段耗时
+// -R 录制输入, -P 按原时间戳重放录制的输入, 与帧哈希一起用于对比不同编译选项
+// 以 -DSIM_DISPLAY_STREAM=1 编译时使用 ssd1306 stream 驱动 (数据传输跨 tile 保持打开)
+#include "btn_fifo.h"
+#include "btn_rec.h"
+#include "enc_input.h"
+#include "page_prof.h"
+#include "page_stack.h"
+#include "sim_demo.h"
+#include "sim_ssd1306.h"
+#include "u8g2.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifndef SIM_DISPLAY_STREAM
+#define SIM_DISPLAY_STREAM 0
+#endif
+
+extern u8g2_t u8g2;
+static uint32_t g_sim_clock_ms;
+
+static uint32_t sim_clock(void) { return g_sim_clock_ms; }
+
+static double sim_wall_sec(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+#if PAGE_PROF_ENABLE
+// 帧分段计时使用纳秒计数, 允许 32 位回绕
+static uint32_t sim_prof_clock(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)(ts.tv_sec * 1000000000ull + ts.tv_nsec);
+}
+
+static void sim_prof_print(const char *fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  vprintf(fmt, args);
+  va_end(args);
+  putchar('\n');
+}
+#endif
+
+// 输入延迟: 事件写入队列到第一个反映它的帧 (page_update 取出事件后绘制的帧) 传输完成的模拟时间.
+// 绘制耗时按 0 计 (主机上远小于帧间隔), 传输时间按该帧的总线字节数估算
+#define SIM_INPUT_RING 64
+#define SIM_I2C_HZ 400000UL // 每字节 9 个时钟 (含 ACK), 每次传输额外 2 个时钟 (START/STOP), 与 bench 相同
+static struct {
+  uint32_t tick[SIM_INPUT_RING]; // 每个事件写入时的时钟
+  unsigned long pushed, taken, shown;
+  unsigned long sum_us, max_us;
+} g_input;
+
+static void sim_input_pushed(void) {
+  g_input.tick[g_input.pushed++ % SIM_INPUT_RING] = g_sim_clock_ms;
+}
+
+// xfer 为显示这些事件的帧的总线统计
+static void sim_input_shown(const sim_ssd1306_stat_t *xfer) {
+  unsigned long xfer_us = (xfer->bytes * 9 + xfer->transfers * 2) * 1000000UL / SIM_I2C_HZ;
+  for (; g_input.shown < g_input.taken; g_input.shown++) {
+    unsigned long us = (g_sim_clock_ms - g_input.tick[g_input.shown % SIM_INPUT_RING]) * 1000UL + xfer_us;
+    g_input.sum_us += us;
+    if (us > g_input.max_us) g_input.max_us = us;
+  }
+}
+
+static void sim_usage(const char *prog) {
+  fprintf(stderr,
+          "usage: %s [-s script] [-k frames_per_key] [-r repeat] [-o pbm_dir]\n"
+          "          [-R record_file] [-P replay_file]\n"
+          "  script keys: w/s/a/d/l/r/h as the UART keys in main.c, '.' idle,\n"
+          "               '>'/'<' one encoder detent (use -k 1 for a fast spin),\n"
+          "               keys in [...] are pushed at once (a UART burst, at most %d)\n"
+          "  -R records the consumed input events (btn_rec format), -P replays such a\n"
+          "     record at its original timestamps instead of running the script\n",
+          prog, BTN_FIFO_SIZE);
+}
+
+// 逐帧统计; 帧哈希 (FNV-1a) 覆盖每个绘制帧的屏幕内容, 同一输入记录在不同编译选项下应相同
+static struct {
+  const char *pbm_dir;
+  unsigned long rendered, calls, bad;
+  double busy_sec;
+  uint32_t hash;
+} g_sim = {.hash = 2166136261u};
+
+static void sim_hash_frame(void) {
+  const uint8_t(*ram)[SIM_SSD1306_COLS] = sim_ssd1306_gddram();
+  for (int page = 0; page < SIM_SSD1306_PAGES; page++)
+    for (int col = 0; col < SIM_SSD1306_COLS; col++) g_sim.hash = (g_sim.hash ^ ram[page][col]) * 16777619u;
+}
+
+// 模拟主循环的一次迭代并前进一帧, 返回 -1 表示无法写入 PBM
+static int sim_frame(int16_t detents) {
+  // 编码器在主循环中每次调用前轮询
+  if (enc_input_update(detents, g_sim_clock_ms)) sim_input_pushed();
+  int btn = btn_fifo_pop_input();
+  sim_ssd1306_stat_t xfer = sim_ssd1306_get_stat();
+  double t0 = sim_wall_sec();
+  bool is_rendered = page_update(&g_page_stack, btn);
+  g_sim.busy_sec += sim_wall_sec() - t0;
+  g_sim.calls++;
+  // 已被取出的输入在绘制的帧中显示
+  g_input.taken = g_input.pushed - btn_fifo_get_count();
+  if (is_rendered) {
+    sim_ssd1306_stat_t stat = sim_ssd1306_get_stat();
+    xfer.bytes = stat.bytes - xfer.bytes;
+    xfer.transfers = stat.transfers - xfer.transfers;
+    sim_input_shown(&xfer);
+  }
+  g_sim_clock_ms += PAGE_FRAME_MS;
+  if (!is_rendered) return 0;
+
+  g_sim.rendered++;
+  sim_hash_frame();
+  if (sim_ssd1306_compare(&u8g2) != 0) g_sim.bad++;
+  if (g_sim.pbm_dir) {
+    char path[256];
+    snprintf(path, sizeof(path), "%s/frame_%05lu.pbm", g_sim.pbm_dir, g_sim.rendered);
+    if (sim_ssd1306_save_pbm(path) != 0) {
+      fprintf(stderr, "cannot write %s\n", path);
+      return -1;
+    }
+  }
+  return 0;
+}
+
+static int sim_run_script(const char *script, int frames_per_key) {
+  for (const char *p = script; *p; p++) {
+    // [...] 中的按键同时写入 (如串口一次收到多个字节), 之后共用一个按键的帧数
+    const char *end = p;
+    if (*p == '[' && (end = strchr(p, ']')) == NULL) end = p + strlen(p) - 1;
+    for (const char *k = p; k <= end; k++) {
+      btn_type_t key = sim_demo_key_to_btn(*k);
+      if (key != BTN_NONE && btn_fifo_push(key)) sim_input_pushed();
+    }
+    int16_t detents = (*p == '>') ? 1 : (*p == '<') ? -1 : 0;
+    p = end;
+
+    // 编码器的格数在本按键的第一帧转入
+    for (int f = 0; f < frames_per_key; f++)
+      if (sim_frame(f == 0 ? detents : 0) != 0) return -1;
+  }
+  return 0;
+}
+
+// 按记录中的时间戳把事件写回队列 (时间戳不变), 运行到录制结束的时刻
+static int sim_run_replay(const char *path) {
+  FILE *fp = fopen(path, "rb");
+  if (!fp) {
+    fprintf(stderr, "cannot open %s\n", path);
+    return -1;
+  }
+  static uint8_t data[1 << 20];
+  size_t len = fread(data, 1, sizeof(data), fp);
+  fclose(fp);
+
+  btn_rec_reader_t reader;
+  btn_event_t ev;
+  if (!btn_rec_reader_init(&reader, data, (uint32_t)len, g_sim_clock_ms)) {
+    fprintf(stderr, "%s: not an input record\n", path);
+    return -1;
+  }
+  bool has_ev = btn_rec_read(&reader, &ev);
+  while (has_ev || (reader.end && (int32_t)(reader.tick - g_sim_clock_ms) > 0)) {
+    // 队列满时留到下一帧
+    while (has_ev && (int32_t)(ev.tick - g_sim_clock_ms) <= 0 &&
+           btn_fifo_push_event(BTN_FIFO_LANE_MAIN, &ev)) {
+      sim_input_pushed();
+      has_ev = btn_rec_read(&reader, &ev);
+    }
+    if (sim_frame(0) != 0) return -1;
+  }
+  if (!reader.end) printf("replay: %s has no end mark, stopped after the last event\n", path);
+  return 0;
+}
+
+static FILE *g_rec_file;
+
+static void sim_rec_write(const uint8_t *data, uint8_t len) { fwrite(data, 1, len, g_rec_file); }
+
+int main(int argc, char **argv) {
+  const char *script = SIM_DEMO_SCRIPT;
+  const char *rec_path = NULL, *replay_path = NULL;
+  int frames_per_key = SIM_DEMO_FRAMES_PER_KEY;
+  int repeat = 1;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "s:k:r:o:R:P:h")) != -1) {
+    switch (opt) {
+    case 's': script = optarg; break;
+    case 'k': frames_per_key = atoi(optarg); break;
+    case 'r': repeat = atoi(optarg); break;
+    case 'o': g_sim.pbm_dir = optarg; break;
+    case 'R': rec_path = optarg; break;
+    case 'P': replay_path = optarg; break;
+    default: sim_usage(argv[0]); return 2;
+    }
+  }
+
+  if (g_sim.pbm_dir) mkdir(g_sim.pbm_dir, 0755);
+
+  sim_ssd1306_reset();
+#if SIM_DISPLAY_STREAM
+  u8g2_Setup_ssd1306_i2c_128x64_stream_f(&u8g2, U8G2_R0, u8x8_byte_sim_ssd1306,
+                                        u8x8_gpio_and_delay_sim);
+#else
+  u8g2_Setup_ssd1306_i2c_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_sim_ssd1306,
+                                        u8x8_gpio_and_delay_sim);
+#endif
+  u8g2_InitDisplay(&u8g2);
+  u8g2_SetPowerSave(&u8g2, 0);
+  btn_fifo_init();
+  btn_fifo_set_clock(sim_clock);
+  enc_input_init();
+  page_stack_init(&g_page_stack, &u8g2);
+  page_stack_register_clock_cb(&g_page_stack, sim_clock);
+  page_prof_init(sim_prof_clock, 1000);
+  sim_demo_init();
+  sim_ssd1306_clear_stat();
+
+  if (rec_path) {
+    g_rec_file = fopen(rec_path, "wb");
+    if (!g_rec_file) {
+      fprintf(stderr, "cannot write %s\n", rec_path);
+      return 2;
+    }
+    btn_rec_start(g_sim_clock_ms, sim_rec_write);
+  }
+
+  if (replay_path) {
+    if (sim_run_replay(replay_path) != 0) return 2;
+  } else {
+    for (int r = 0; r < repeat; r++)
+      if (sim_run_script(script, frames_per_key) != 0) return 2;
+  }
+
+  if (rec_path) {
+    btn_rec_stop(g_sim_clock_ms);
+    fclose(g_rec_file);
+  }
+
+  sim_ssd1306_stat_t stat = sim_ssd1306_get_stat();
+  printf("frames: %lu rendered, %lu skipped (%lu idle) of %lu, %.1f s simulated\n",
+         g_sim.rendered, g_sim.calls - g_sim.rendered, (unsigned long)g_page_stack.skipped_frames,
+         g_sim.calls, g_sim_clock_ms / 1000.0);
+  if (g_sim.rendered > 0) {
+    printf("render: %.1f fps, %.2f us/frame\n", g_sim.rendered / g_sim.busy_sec,
+           g_sim.busy_sec * 1e6 / g_sim.rendered);
+    printf("bus:    %.1f bytes/frame, %.1f xfers/frame\n",
+           (double)stat.bytes / g_sim.rendered, (double)stat.transfers / g_sim.rendered);
+  }
+  if (g_input.shown > 0) {
+    printf("input:  %lu events, latency %.1f ms avg, %.1f ms max\n", g_input.shown,
+           g_input.sum_us / 1000.0 / g_input.shown, g_input.max_us / 1000.0);
+  }
+  printf("hash:   %08lx (%lu bytes on the bus)\n", (unsigned long)g_sim.hash, stat.bytes);
+#if PAGE_STACK_PORTAL_LAYER
+  printf("layer:  %lu portal frames composited\n", (unsigned long)g_page_stack.layer_frames);
+#endif
+#ifdef U8G2_WITH_GLYPH_CACHE
+  u8g2_glyph_cache_stat_t glyph_stat;
+  u8g2_GetGlyphCacheStat(&glyph_stat);
+  printf("glyph:  %lu hits, %lu misses, %lu evicted, %lu bypassed, %u/%d bytes\n",
+         (unsigned long)glyph_stat.hit, (unsigned long)glyph_stat.miss,
+         (unsigned long)glyph_stat.evict, (unsigned long)glyph_stat.bypass, glyph_stat.used,
+         U8G2_GLYPH_CACHE_SIZE);
+#endif
+  page_prof_dump(sim_prof_print);
+  if (g_sim.bad) printf("ERROR: %lu frames differ from the frame buffer\n", g_sim.bad);
+  return g_sim.bad != 0;
+}
@@ -1,5 +1,54 @@
 #include "stm32f10x.h"
 
+static volatile uint32_t g_delay_tick = 0;		//SysTick 毫秒计数
+
+#define DWT_CTRL	(*(volatile uint32_t *)0xE0001000)	//DWT 控制寄存器
+#define DWT_CYCCNT	(*(volatile uint32_t *)0xE0001004)	//DWT 周期计数器
+
+/**
+  * @brief  启动 SysTick 1ms 中断, 作为系统毫秒时钟, 并启动 DWT 周期计数器
+  * @param  无
+  * @retval 无
+  */
+void Delay_Init(void)
+{
+	SysTick_Config(SystemCoreClock / 1000);
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT_CYCCNT = 0;
+	DWT_CTRL |= 1;							//CYCCNTENA
+}
+
+/**
+  * @brief  SysTick 中断中调用, 毫秒计数加一
+  * @param  无
+  * @retval 无
+  */
+void Delay_IncTick(void)
+{
+	g_delay_tick++;
+}
+
+/**
+  * @brief  获取系统毫秒时钟
+  * @param  无
+  * @retval 上电 (Delay_Init) 以来的毫秒数, 约 49 天回绕
+  */
+uint32_t Delay_GetTick(void)
+{
+	return g_delay_tick;
+}
+
+/**
+  * @brief  获取 CPU 周期计数 (DWT_CYCCNT), 用于精确计时
+  * @param  无
+  * @retval 周期数, 72MHz 下约 59 秒回绕
+  */
+uint32_t Delay_GetCycle(void)
+{
+	return DWT_CYCCNT;
+}
+
 /**
   * @brief  微秒级延时
   * @param  xus 延时时长，范围：0~233015
@@ -7,11 +56,27 @@
   */
 void Delay_us(uint32_t xus)
 {
-	SysTick->LOAD = 72 * xus;				//设置定时器重装值
-	SysTick->VAL = 0x00;					//清空当前计数值
-	SysTick->CTRL = 0x00000005;				//设置时钟源为HCLK，启动定时器
-	while(!(SysTick->CTRL & 0x00010000));	//等待计数到0
-	SysTick->CTRL = 0x00000004;				//关闭定时器
+	if (!(SysTick->CTRL & SysTick_CTRL_ENABLE_Msk))
+	{
+		SysTick->LOAD = 72 * xus;				//设置定时器重装值
+		SysTick->VAL = 0x00;					//清空当前计数值
+		SysTick->CTRL = 0x00000005;				//设置时钟源为HCLK，启动定时器
+		while(!(SysTick->CTRL & 0x00010000));	//等待计数到0
+		SysTick->CTRL = 0x00000004;				//关闭定时器
+		return;
+	}
+
+	//SysTick 已作为毫秒时钟运行, 不能重新配置, 改为累计 VAL 的递减量
+	uint32_t ticks = xus * (SystemCoreClock / 1000000);
+	uint32_t reload = SysTick->LOAD + 1;
+	uint32_t last = SysTick->VAL;
+	uint32_t elapsed = 0;
+	while (elapsed < ticks)
+	{
+		uint32_t now = SysTick->VAL;
+		elapsed += (last >= now) ? (last - now) : (last + reload - now);
+		last = now;
+	}
 }
 
 /**
@@ -3,6 +3,10 @@
 
 #include "stdint.h"
 
+void Delay_Init(void);
+void Delay_IncTick(void);
+uint32_t Delay_GetTick(void);
+uint32_t Delay_GetCycle(void);
 void Delay_us(uint32_t us);
 void Delay_ms(uint32_t ms);
 void Delay_s(uint32_t s);
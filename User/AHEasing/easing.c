@@ -26,11 +26,11 @@
 // For more information, please refer to <https://unlicense.org>
 //
 #ifndef M_PI
-#define M_PI        3.14159265358979323846f  // 
+#define M_PI        3.14159265358979323846f  // π
 #endif
 
 #ifndef M_PI_2
-#define M_PI_2      1.57079632679489661923f  // /2
+#define M_PI_2      1.57079632679489661923f  // π/2
 #endif
 #include <math.h>
 #include "easing.h"
@@ -0,0 +1,176 @@
+#include "easing_q16.h"
+
+// 公式与 easing.c 一一对应, 注释中 x 为 [0, 1] 的进度.
+// 分段函数的前半段按 (2x)^n / 2 计算, 避免先截断 x^n 再放大误差
+
+// 相位 = x * k / 4 周, 即 sin(k * π/2 * x); k * x 超出 32 位时回绕, 相当于对整周取模
+#define PHASE_HALF_PI(x, k) ((uint32_t)(x) * (uint32_t)(k) << 14)
+
+static inline q16_t sqr(q16_t p) { return fix_mul(p, p); }
+
+// y = x
+q16_t LinearInterpolationQ16(q16_t p) { return p; }
+
+// y = x^2
+q16_t QuadraticEaseInQ16(q16_t p) { return sqr(p); }
+
+// y = -x^2 + 2x
+q16_t QuadraticEaseOutQ16(q16_t p) { return -fix_mul(p, p - 2 * Q16_ONE); }
+
+// y = (1/2)((2x)^2)             ; [0, 0.5)
+// y = -(1/2)((2x-1)*(2x-3) - 1) ; [0.5, 1]
+q16_t QuadraticEaseInOutQ16(q16_t p) {
+  if (p < Q16_HALF) return 2 * sqr(p);
+  return -2 * sqr(p) + 4 * p - Q16_ONE;
+}
+
+// y = x^3
+q16_t CubicEaseInQ16(q16_t p) { return fix_mul(sqr(p), p); }
+
+// y = (x - 1)^3 + 1
+q16_t CubicEaseOutQ16(q16_t p) {
+  q16_t f = p - Q16_ONE;
+  return fix_mul(sqr(f), f) + Q16_ONE;
+}
+
+// y = (1/2)((2x)^3)       ; [0, 0.5)
+// y = (1/2)((2x-2)^3 + 2) ; [0.5, 1]
+q16_t CubicEaseInOutQ16(q16_t p) {
+  if (p < Q16_HALF) return fix_mul(sqr(2 * p), 2 * p) / 2;
+  q16_t f = 2 * p - 2 * Q16_ONE;
+  return fix_mul(sqr(f), f) / 2 + Q16_ONE;
+}
+
+// y = x^4
+q16_t QuarticEaseInQ16(q16_t p) { return sqr(sqr(p)); }
+
+// y = 1 - (x - 1)^4
+q16_t QuarticEaseOutQ16(q16_t p) {
+  q16_t f = p - Q16_ONE;
+  return Q16_ONE - sqr(sqr(f));
+}
+
+// y = (1/2)((2x)^4)        ; [0, 0.5)
+// y = -(1/2)((2x-2)^4 - 2) ; [0.5, 1]
+q16_t QuarticEaseInOutQ16(q16_t p) {
+  if (p < Q16_HALF) return sqr(sqr(2 * p)) / 2;
+  q16_t f = 2 * p - 2 * Q16_ONE;
+  return Q16_ONE - sqr(sqr(f)) / 2;
+}
+
+// y = x^5
+q16_t QuinticEaseInQ16(q16_t p) { return fix_mul(sqr(sqr(p)), p); }
+
+// y = (x - 1)^5 + 1
+q16_t QuinticEaseOutQ16(q16_t p) {
+  q16_t f = p - Q16_ONE;
+  return fix_mul(sqr(sqr(f)), f) + Q16_ONE;
+}
+
+// y = (1/2)((2x)^5)       ; [0, 0.5)
+// y = (1/2)((2x-2)^5 + 2) ; [0.5, 1]
+q16_t QuinticEaseInOutQ16(q16_t p) {
+  if (p < Q16_HALF) return fix_mul(sqr(sqr(2 * p)), 2 * p) / 2;
+  q16_t f = 2 * p - 2 * Q16_ONE;
+  return fix_mul(sqr(sqr(f)), f) / 2 + Q16_ONE;
+}
+
+// y = sin((x - 1) * π/2) + 1
+q16_t SineEaseInQ16(q16_t p) { return fix_sin_phase(PHASE_HALF_PI(p - Q16_ONE, 1)) + Q16_ONE; }
+
+// y = sin(x * π/2)
+q16_t SineEaseOutQ16(q16_t p) { return fix_sin_phase(PHASE_HALF_PI(p, 1)); }
+
+// y = (1/2)(1 - cos(x * π))
+q16_t SineEaseInOutQ16(q16_t p) { return (Q16_ONE - fix_cos_phase(PHASE_HALF_PI(p, 2))) / 2; }
+
+// [0, 1] 内两个 Q16 数之积的平方根: 乘积保留为 Q32, 开方后即为 Q16, 接近 0 时也不丢精度
+static q16_t sqrt_mul(q16_t a, q16_t b) {
+  uint64_t v = (uint64_t)((int64_t)a * b);
+  return (v >= (1ULL << 32)) ? Q16_ONE : (q16_t)fix_isqrt((uint32_t)v);
+}
+
+// y = 1 - sqrt(1 - x^2)
+q16_t CircularEaseInQ16(q16_t p) { return Q16_ONE - sqrt_mul(Q16_ONE - p, Q16_ONE + p); }
+
+// y = sqrt((2 - x) * x)
+q16_t CircularEaseOutQ16(q16_t p) { return sqrt_mul(2 * Q16_ONE - p, p); }
+
+// y = (1/2)(1 - sqrt(1 - 4x^2))           ; [0, 0.5)
+// y = (1/2)(sqrt(-(2x - 3)*(2x - 1)) + 1) ; [0.5, 1]
+q16_t CircularEaseInOutQ16(q16_t p) {
+  if (p < Q16_HALF) return (Q16_ONE - sqrt_mul(Q16_ONE - 2 * p, Q16_ONE + 2 * p)) / 2;
+  return (sqrt_mul(3 * Q16_ONE - 2 * p, 2 * p - Q16_ONE) + Q16_ONE) / 2;
+}
+
+// y = 2^(10(x - 1))
+q16_t ExponentialEaseInQ16(q16_t p) {
+  return (p == 0) ? p : fix_exp2(10 * (p - Q16_ONE));
+}
+
+// y = -2^(-10x) + 1
+q16_t ExponentialEaseOutQ16(q16_t p) {
+  return (p == Q16_ONE) ? p : Q16_ONE - fix_exp2(-10 * p);
+}
+
+// y = (1/2)2^(10(2x - 1))         ; [0,0.5)
+// y = -(1/2)*2^(-10(2x - 1))) + 1 ; [0.5,1]
+q16_t ExponentialEaseInOutQ16(q16_t p) {
+  if (p == 0 || p == Q16_ONE) return p;
+  if (p < Q16_HALF) return fix_exp2(20 * p - 10 * Q16_ONE) / 2;
+  return Q16_ONE - fix_exp2(-20 * p + 10 * Q16_ONE) / 2;
+}
+
+// y = sin(13π/2*x) * 2^(10(x - 1))
+q16_t ElasticEaseInQ16(q16_t p) {
+  return fix_mul(fix_sin_phase(PHASE_HALF_PI(p, 13)), fix_exp2(10 * (p - Q16_ONE)));
+}
+
+// y = sin(-13π/2*(x + 1)) * 2^(-10x) + 1
+q16_t ElasticEaseOutQ16(q16_t p) {
+  return fix_mul(fix_sin_phase(-PHASE_HALF_PI(p + Q16_ONE, 13)), fix_exp2(-10 * p)) + Q16_ONE;
+}
+
+// y = (1/2)*sin(13π/2*(2x))*2^(10(2x - 1))                ; [0,0.5)
+// y = (1/2)*(sin(-13π/2*((2x-1)+1))*2^(-10(2x-1)) + 2)    ; [0.5, 1]
+q16_t ElasticEaseInOutQ16(q16_t p) {
+  if (p < Q16_HALF)
+    return fix_mul(fix_sin_phase(PHASE_HALF_PI(2 * p, 13)), fix_exp2(10 * (2 * p - Q16_ONE))) / 2;
+  return (fix_mul(fix_sin_phase(-PHASE_HALF_PI(2 * p, 13)), fix_exp2(-10 * (2 * p - Q16_ONE))) +
+          2 * Q16_ONE) / 2;
+}
+
+// f^3 - f*sin(f*π)
+static q16_t back_in(q16_t f) {
+  return fix_mul(sqr(f), f) - fix_mul(f, fix_sin_phase(PHASE_HALF_PI(f, 2)));
+}
+
+// y = x^3-x*sin(x*π)
+q16_t BackEaseInQ16(q16_t p) { return back_in(p); }
+
+// y = 1-((1-x)^3-(1-x)*sin((1-x)*π))
+q16_t BackEaseOutQ16(q16_t p) { return Q16_ONE - back_in(Q16_ONE - p); }
+
+// y = (1/2)*((2x)^3-(2x)*sin(2*x*π))           ; [0, 0.5)
+// y = (1/2)*(1-((1-x)^3-(1-x)*sin((1-x)*π))+1) ; [0.5, 1]
+q16_t BackEaseInOutQ16(q16_t p) {
+  if (p < Q16_HALF) return back_in(2 * p) / 2;
+  return (Q16_ONE - back_in(2 * Q16_ONE - 2 * p)) / 2 + Q16_HALF;
+}
+
+q16_t BounceEaseInQ16(q16_t p) { return Q16_ONE - BounceEaseOutQ16(Q16_ONE - p); }
+
+q16_t BounceEaseOutQ16(q16_t p) {
+  q16_t p2 = sqr(p);
+  if (p < Q16(4 / 11.0)) return fix_mul(Q16(121 / 16.0), p2);
+  if (p < Q16(8 / 11.0))
+    return fix_mul(Q16(363 / 40.0), p2) - fix_mul(Q16(99 / 10.0), p) + Q16(17 / 5.0);
+  if (p < Q16(9 / 10.0))
+    return fix_mul(Q16(4356 / 361.0), p2) - fix_mul(Q16(35442 / 1805.0), p) + Q16(16061 / 1805.0);
+  return fix_mul(Q16(54 / 5.0), p2) - fix_mul(Q16(513 / 25.0), p) + Q16(268 / 25.0);
+}
+
+q16_t BounceEaseInOutQ16(q16_t p) {
+  if (p < Q16_HALF) return BounceEaseInQ16(p * 2) / 2;
+  return BounceEaseOutQ16(p * 2 - Q16_ONE) / 2 + Q16_HALF;
+}
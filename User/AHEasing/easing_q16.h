@@ -0,0 +1,58 @@
+#ifndef __EASING_Q16_H__
+#define __EASING_Q16_H__
+
+#include "fixmath.h"
+
+// AHEasing 缓动函数的 Q16.16 定点版本: 参数与返回值含义与 easing.h 中的同名函数相同,
+// 进度 p 为 [0, Q16_ONE]. 多项式类只用整数乘法, Sine/Elastic/Back 查正弦表, Exponential 查 2^x 表
+
+// 由浮点版本的函数名得到定点版本, 可直接使用 VLIST_ANIM_FUC 等配置宏:
+// EASING_Q16(QuadraticEaseOut)(p) 即 QuadraticEaseOutQ16(p)
+#define EASING_Q16(fn) EASING_Q16_(fn)
+#define EASING_Q16_(fn) fn##Q16
+
+typedef q16_t (*EasingQ16Function)(q16_t);
+
+q16_t LinearInterpolationQ16(q16_t p);
+
+q16_t QuadraticEaseInQ16(q16_t p);
+q16_t QuadraticEaseOutQ16(q16_t p);
+q16_t QuadraticEaseInOutQ16(q16_t p);
+
+q16_t CubicEaseInQ16(q16_t p);
+q16_t CubicEaseOutQ16(q16_t p);
+q16_t CubicEaseInOutQ16(q16_t p);
+
+q16_t QuarticEaseInQ16(q16_t p);
+q16_t QuarticEaseOutQ16(q16_t p);
+q16_t QuarticEaseInOutQ16(q16_t p);
+
+q16_t QuinticEaseInQ16(q16_t p);
+q16_t QuinticEaseOutQ16(q16_t p);
+q16_t QuinticEaseInOutQ16(q16_t p);
+
+q16_t SineEaseInQ16(q16_t p);
+q16_t SineEaseOutQ16(q16_t p);
+q16_t SineEaseInOutQ16(q16_t p);
+
+q16_t CircularEaseInQ16(q16_t p);
+q16_t CircularEaseOutQ16(q16_t p);
+q16_t CircularEaseInOutQ16(q16_t p);
+
+q16_t ExponentialEaseInQ16(q16_t p);
+q16_t ExponentialEaseOutQ16(q16_t p);
+q16_t ExponentialEaseInOutQ16(q16_t p);
+
+q16_t ElasticEaseInQ16(q16_t p);
+q16_t ElasticEaseOutQ16(q16_t p);
+q16_t ElasticEaseInOutQ16(q16_t p);
+
+q16_t BackEaseInQ16(q16_t p);
+q16_t BackEaseOutQ16(q16_t p);
+q16_t BackEaseInOutQ16(q16_t p);
+
+q16_t BounceEaseInQ16(q16_t p);
+q16_t BounceEaseOutQ16(q16_t p);
+q16_t BounceEaseInOutQ16(q16_t p);
+
+#endif
@@ -1,5 +1,6 @@
-#include "hlist.h"
+#include "HList.h"
 #include "u8g2.h"
+#include "ui_toolkit.h"
 #include <math.h>
 #include <string.h>
 
@@ -86,6 +87,204 @@ void hlist_add_protected_glyph_item(hlist_t *hl, const char *title,
   }
 }
 
+#if HLIST_ICON_CACHE_SLOTS
+// 光栅化区域: 图标位置四周各留出 HLIST_ICON_MARGIN 像素, 容纳字形超出图标位置的部分
+#define HLIST_ICON_MARGIN 4
+#define HLIST_ICON_AREA_W (ICON_WIDTH + 2 * HLIST_ICON_MARGIN)
+#define HLIST_ICON_AREA_PAGES ((ICON_HEIGHT + 2 * HLIST_ICON_MARGIN + 7) / 8)
+
+// 图标图像只保存图标框 (XBM 矩形或字形框) 内的像素, 页格式, 每字节 8 行 (低位在上)
+typedef struct {
+  const void *src; // XBM 数据或图标字体, NULL 表示空项
+  uint16_t glyph;  // 字形编码, XBM 为 0
+  bool is_glyph;
+  u8g2_font_calc_vref_fnptr calc_vref; // 光栅化时的字体参考线
+  int8_t x, y;                         // 图标框左上角相对于图标位置的偏移
+  uint8_t w, h;                        // 图标框尺寸, 不超过 ICON_WIDTH x ICON_HEIGHT
+  uint32_t last_use;
+  uint8_t fg[(ICON_HEIGHT + 7) / 8][ICON_WIDTH]; // 前景像素, 框内其余像素为背景
+} hlist_icon_t;
+
+static hlist_icon_t g_hlist_icons[HLIST_ICON_CACHE_SLOTS];
+static uint32_t g_hlist_icon_use_cnt;
+static u8g2_t g_hlist_icon_u8g2; // 光栅化用的 u8g2 副本
+static uint8_t g_hlist_icon_buf[HLIST_ICON_AREA_PAGES][HLIST_ICON_AREA_W];
+
+/**
+ * @brief 按 hlist_draw 的方式把图标画到光栅化区域 (背景不透明, 颜色为 1)
+ * @param fill 绘制前的像素值
+ */
+static void hlist_icon_render(const u8g2_t *u8g2, const hlist_item_t *item, uint8_t fill) {
+  u8g2_t *m = &g_hlist_icon_u8g2;
+  ui_offscreen_init(m, u8g2, &g_hlist_icon_buf[0][0], HLIST_ICON_AREA_W, HLIST_ICON_AREA_W,
+                    HLIST_ICON_AREA_PAGES);
+  u8g2_SetDrawColor(m, 1);
+  memset(g_hlist_icon_buf, fill, sizeof(g_hlist_icon_buf));
+  if (item->icon_type == ICON_TYPE_XBM) {
+    u8g2_SetBitmapMode(m, 0);
+    u8g2_DrawXBM(m, HLIST_ICON_MARGIN, HLIST_ICON_MARGIN, ICON_WIDTH, ICON_HEIGHT,
+                 item->icon_data.xbm);
+  } else {
+    u8g2_SetFont(m, g_screen_cfg.icon_font);
+    u8g2_SetFontMode(m, 0);
+    u8g2_DrawGlyph(m, HLIST_ICON_MARGIN + 2, HLIST_ICON_MARGIN + ICON_HEIGHT - 2,
+                   item->icon_data.glyph);
+  }
+}
+
+static uint8_t hlist_icon_pixel(int x, int y) { return (g_hlist_icon_buf[y >> 3][x] >> (y & 7)) & 1; }
+
+/**
+ * @brief 取图标的图像, 不存在时光栅化并替换最久未使用的项
+ * @return 图标框超出光栅化区域或大于 ICON_WIDTH x ICON_HEIGHT 时返回 NULL
+ */
+static const hlist_icon_t *hlist_icon_get(const u8g2_t *u8g2, const hlist_item_t *item) {
+  const void *src;
+  uint16_t glyph = 0;
+  bool is_glyph = item->icon_type != ICON_TYPE_XBM;
+  hlist_icon_t *ic, *lru = &g_hlist_icons[0];
+  int x0 = HLIST_ICON_AREA_W, y0 = HLIST_ICON_AREA_PAGES * 8, x1 = -1, y1 = -1;
+
+  if (is_glyph) {
+    src = g_screen_cfg.icon_font;
+    glyph = item->icon_data.glyph;
+  } else {
+    src = item->icon_data.xbm;
+  }
+  if (src == NULL) return NULL;
+
+  for (ic = g_hlist_icons; ic < g_hlist_icons + HLIST_ICON_CACHE_SLOTS; ic++) {
+    if (ic->src == src && ic->glyph == glyph && ic->is_glyph == is_glyph &&
+        ic->calc_vref == u8g2->font_calc_vref) {
+      ic->last_use = ++g_hlist_icon_use_cnt;
+      return ic;
+    }
+    if (ic->last_use < lru->last_use) lru = ic;
+  }
+
+  // 图标框为前景与背景像素的外接矩形: 在全 1 的区域上绘制找出背景, 在全 0 的区域上绘制找出前景
+  for (int pass = 0; pass < 2; pass++) {
+    hlist_icon_render(u8g2, item, pass == 0 ? 0xff : 0);
+    for (int y = 0; y < HLIST_ICON_AREA_PAGES * 8; y++)
+      for (int x = 0; x < HLIST_ICON_AREA_W; x++) {
+        if (hlist_icon_pixel(x, y) == (pass == 0)) continue;
+        if (x < x0) x0 = x;
+        if (x > x1) x1 = x;
+        if (y < y0) y0 = y;
+        if (y > y1) y1 = y;
+      }
+  }
+  if (x1 < 0) {
+    x0 = y0 = HLIST_ICON_MARGIN; // 没有像素, 保存为空图像
+    x1 = y1 = HLIST_ICON_MARGIN - 1;
+  }
+  // 碰到区域边缘说明图标可能被截断
+  if (x0 == 0 || y0 == 0 || x1 == HLIST_ICON_AREA_W - 1 || y1 == HLIST_ICON_AREA_PAGES * 8 - 1)
+    return NULL;
+  if (x1 - x0 + 1 > ICON_WIDTH || y1 - y0 + 1 > ICON_HEIGHT) return NULL;
+
+  ic = lru;
+  ic->src = src;
+  ic->glyph = glyph;
+  ic->is_glyph = is_glyph;
+  ic->calc_vref = u8g2->font_calc_vref;
+  ic->x = (int8_t)(x0 - HLIST_ICON_MARGIN);
+  ic->y = (int8_t)(y0 - HLIST_ICON_MARGIN);
+  ic->w = (uint8_t)(x1 - x0 + 1);
+  ic->h = (uint8_t)(y1 - y0 + 1);
+  ic->last_use = ++g_hlist_icon_use_cnt;
+  memset(ic->fg, 0, sizeof(ic->fg));
+  for (int y = 0; y < ic->h; y++)
+    for (int x = 0; x < ic->w; x++)
+      ic->fg[y >> 3][x] |= (uint8_t)(hlist_icon_pixel(x0 + x, y0 + y) << (y & 7));
+  return ic;
+}
+
+/**
+ * @brief 把图标图像拷贝到缓冲区, 图标位置为 (x, y).
+ *        按当前裁剪窗口、绘制颜色与字体/位图模式写入, 与直接绘制图标的结果相同
+ */
+static void hlist_icon_blit(u8g2_t *u8g2, const hlist_icon_t *ic, int x, int y) {
+  int gx, gy, x0, x1, y0, y1;
+  uint8_t fg_or, fg_xor, bg_or, bg_xor, is_opaque;
+
+#ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
+  if (u8g2->is_page_clip_window_intersection == 0) return;
+#endif
+  gx = x + ic->x;
+  gy = y + ic->y;
+  x0 = gx > u8g2->user_x0 ? gx : u8g2->user_x0;
+  x1 = gx + ic->w < u8g2->user_x1 ? gx + ic->w : u8g2->user_x1;
+  y0 = gy > u8g2->user_y0 ? gy : u8g2->user_y0;
+  y1 = gy + ic->h < u8g2->user_y1 ? gy + ic->h : u8g2->user_y1;
+  if (x0 >= x1 || y0 >= y1) return;
+
+  // 转换为缓冲区坐标
+  gy -= u8g2->pixel_curr_row;
+  y0 -= u8g2->pixel_curr_row;
+  y1 -= u8g2->pixel_curr_row;
+
+  // 与字形缓存相同: pixel |= or_mask; pixel ^= xor_mask
+  fg_or = u8g2->draw_color <= 1 ? 0xff : 0;
+  fg_xor = u8g2->draw_color != 1 ? 0xff : 0;
+  bg_or = 0;
+  bg_xor = 0;
+  is_opaque = ic->is_glyph ? u8g2->font_decode.is_transparent == 0 : u8g2->bitmap_transparency == 0;
+  if (is_opaque) {
+    bg_or = 0xff;
+    if (u8g2->draw_color != 0) bg_xor = 0xff;
+    u8g2_MarkDirtyBox(u8g2, x0, y0, x1 - x0, y1 - y0);
+  }
+
+  for (int page = y0 >> 3; page * 8 < y1; page++) {
+    uint8_t mask = 0xff;
+    if (page * 8 < y0) mask <<= y0 & 7;
+    if (page * 8 + 8 > y1) mask &= 0xff >> (page * 8 + 8 - y1);
+
+    // 本页第 0 行对应图像的第 k 行, 由图像相邻两页的字节拼出
+    int k = page * 8 - gy;
+    const uint8_t *lo = NULL, *hi = NULL;
+    uint8_t ls = 0, hs;
+    if (k < 0) {
+      hi = ic->fg[0];
+      hs = -k;
+    } else {
+      lo = ic->fg[k >> 3];
+      ls = k & 7;
+      hs = 8 - ls;
+      if (ls != 0 && (k >> 3) + 1 < (ic->h + 7) >> 3) hi = ic->fg[(k >> 3) + 1];
+    }
+
+    uint8_t *dst = u8g2->tile_buf_ptr + page * u8g2->pixel_buf_width;
+    int tile = -1;
+    for (int c = x0; c < x1; c++) {
+      uint8_t v = 0;
+      if (lo) v = lo[c - gx] >> ls;
+      if (hi) v |= hi[c - gx] << hs;
+      uint8_t f = v & mask;
+      // 透明模式只标记有前景像素的 tile, 与直接绘制相同
+      if (!is_opaque && f != 0 && tile != c >> 3) {
+        tile = c >> 3;
+        u8g2_MarkDirtyBox(u8g2, c, page * 8, 1, 1);
+      }
+      uint8_t b = ~v & mask;
+      uint8_t d = dst[c];
+      d |= f & fg_or;
+      d ^= f & fg_xor;
+      d |= b & bg_or;
+      d ^= b & bg_xor;
+      dst[c] = d;
+    }
+  }
+}
+#endif
+
+void hlist_icon_cache_clear(void) {
+#if HLIST_ICON_CACHE_SLOTS
+  memset(g_hlist_icons, 0, sizeof(g_hlist_icons));
+#endif
+}
+
 void hlist_draw(u8g2_t *u8g2, void *ctx) {
     if (!u8g2 || !ctx) return;
     hlist_t *hl = (hlist_t *)ctx;
@@ -97,19 +296,37 @@ void hlist_draw(u8g2_t *u8g2, void *ctx) {
     u8g2_SetDrawColor(u8g2, 1);
 
     uint32_t elapsed = *hl->main_tick - hl->start_tick;
-    if (elapsed > HLIST_ANIM_TICKS * 2) elapsed = HLIST_ANIM_TICKS;
-    float p = (float)elapsed / HLIST_ANIM_TICKS;
+    if (elapsed > HLIST_ANIM_MS * 2) elapsed = HLIST_ANIM_MS;
+#if UI_FIXED_MATH
+    q16_t p = fix_progress(elapsed, HLIST_ANIM_MS);
+    if (p < Q16_ONE) page_stack_request_frame(&g_page_stack);
+    q16_t ease_idx = fix_lerp_int(hl->from_index, hl->to_index, EASING_Q16(HLIST_ICON_ANIM)(p));
+#else
+    float p = (float)elapsed / HLIST_ANIM_MS;
     p = fminf(fmaxf(p, 0.0f), 1.0f);
+    if (p < 1.0f) page_stack_request_frame(&g_page_stack);
     float ease_idx = hl->from_index + (hl->to_index - hl->from_index) * HLIST_ICON_ANIM(p);
+#endif
 
     int screen_mid = screen_cfg->width / 2;
     int icon_gap = ICON_GAP;
 
     for (int i = 0; i < hl->count; i++) {
+#if UI_FIXED_MATH
+        int x = screen_mid + fix_mul_int(fix_from_int(i) - ease_idx, icon_gap) - (ICON_WIDTH / 2);
+#else
         int x = screen_mid + (int)((i - ease_idx) * icon_gap) - (ICON_WIDTH / 2);
+#endif
         if (x < -ICON_WIDTH || x > screen_cfg->width) continue;
 
         int icon_y = (screen_cfg->height - ICON_HEIGHT - screen_cfg->font_height - 4) / 2;
+#if HLIST_ICON_CACHE_SLOTS
+        const hlist_icon_t *ic = hlist_icon_get(u8g2, &hl->items[i]);
+        if (ic != NULL) {
+            hlist_icon_blit(u8g2, ic, x, icon_y);
+            continue;
+        }
+#endif
         if (hl->items[i].icon_type == ICON_TYPE_XBM) {
             u8g2_DrawXBM(u8g2, x, icon_y, ICON_WIDTH, ICON_HEIGHT, hl->items[i].icon_data.xbm);
         } else {
@@ -121,13 +338,19 @@ void hlist_draw(u8g2_t *u8g2, void *ctx) {
     u8g2_SetFont(u8g2, HLIST_TEXT_FONT);
     const char *title = hl->items[hl->to_index].title;
     if (title) {
-        int text_width = u8g2_GetStrWidth(u8g2, title);
+        int text_width = str_width_get(u8g2, title);
         int text_x = (screen_cfg->width - text_width) / 2;
         int text_base_y = screen_cfg->height - 10;
         
+#if UI_FIXED_MATH
+        if (p < Q16_ONE) {
+            q16_t text_p = EASING_Q16(HLIST_TEXT_ANIM)(p);
+            int y_off = fix_mul_int(Q16_ONE - text_p, 10);
+#else
         if (p < 1.0f) { 
             float text_p = HLIST_TEXT_ANIM(p);
             int y_off = (int)(10 * (1.0f - text_p)); 
+#endif
             u8g2_DrawStr(u8g2, text_x, text_base_y + y_off, title);
         } else {
             u8g2_DrawStr(u8g2, text_x, text_base_y, title);
@@ -169,4 +392,5 @@ void hlist_input(int btn, void *ctx) {
   }
 }
 
-const page_component_t HLIST_COMP = {hlist_draw, hlist_input};
\ No newline at end of file
+const page_component_t HLIST_COMP = {
+    .draw = hlist_draw, .input = hlist_input, .multi_step = false};
\ No newline at end of file
@@ -7,36 +7,41 @@
 #include "screen.h"
 #include "portal_component.h"
 
-// ==========   ==========
+// ==========  配置项 ==========
 #define ICON_WIDTH 32
 #define ICON_HEIGHT 32
 #define ICON_GAP 50
-// ıʹõ
+// 配置文本使用的字体
 #define HLIST_TEXT_FONT u8g2_font_8x13_tr
-// ʱ
-#define HLIST_ANIM_TICKS 15
-// ͼʹõĻ
+// 动画时长 (ms)
+#define HLIST_ANIM_MS 300
+// 图标使用的缓动动画
 #define HLIST_ICON_ANIM QuinticEaseInOut
 #define HLIST_TEXT_ANIM QuinticEaseOut
+// 图标预光栅化缓存: 图标 (XBM 或字形) 首次绘制时转换为页格式图像, 之后每帧按字节移位拷贝,
+// 轮播的开销与图标来源无关. 按最近使用淘汰, 为 0 时按原方式绘制
+#ifndef HLIST_ICON_CACHE_SLOTS
+#define HLIST_ICON_CACHE_SLOTS 4 // 缓存的图标数 (屏幕上最多同时显示 4 个图标)
+#endif
 
-// ͼö
+// 图标类型枚举
 typedef enum {
-  ICON_TYPE_XBM,  // XBMλͼͼ
-  ICON_TYPE_GLYPH // ַͼ
+  ICON_TYPE_XBM,  // XBM位图图标
+  ICON_TYPE_GLYPH // 字符图标
 } icon_type_t;
 
-// ========== ṹ嶨  ==========
+// ========== 结构体定义  ==========
 typedef struct {
-  bool guard_flag; // ־true=ɽ룬false=ʾ
+  bool guard_flag; // 保护标志：true=可进入，false=弹出提示
   char *alert_text;
 } hlist_protect_t;
 
 typedef struct {
   const char *title;
-  icon_type_t icon_type; // ͼ
-  union {                // 洢ͬ͵ͼ
-    const uint8_t *xbm;  // XBMλͼ
-    uint16_t glyph;      // Glyphַ
+  icon_type_t icon_type; // 图标类型
+  union {                // 共用体存储不同类型的图标数据
+    const uint8_t *xbm;  // XBM位图数据
+    uint16_t glyph;      // Glyph字符编码
   } icon_data;
   const page_component_t *comp;
   void *ctx;
@@ -50,11 +55,11 @@ typedef struct {
   uint32_t start_tick;
   uint32_t *main_tick;
   struct {
-    char *text;  // ʾı
+    char *text;  // 提示文本
   } alert;
 } hlist_t;
 
-// ==========  ⲿ ==========
+// ==========  外部定义 ==========
 extern const page_component_t HLIST_COMP;
 
 void hlist_init(hlist_t *hl, uint32_t *tick_ptr);
@@ -71,4 +76,9 @@ void hlist_add_protected_glyph_item(hlist_t *hl, const char *title,
                                     const page_component_t *comp, void *ctx,
                                     bool guard_flag, char *alert_text);
 
+/**
+ * @brief 清空图标缓存 (如修改了 RAM 中的 XBM 数据)
+ */
+void hlist_icon_cache_clear(void);
+
 #endif
\ No newline at end of file
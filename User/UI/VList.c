@@ -1,4 +1,5 @@
 #include "VList.h"
+#include "num_fmt.h"
 #include "u8g2.h"
 #include <math.h>
 #include <stdint.h>
@@ -11,9 +12,75 @@
 #define PREFIX_PROGRESS	"~"
 #endif
 
+// 虚拟列表最近取过的行, 以 (列表, 行号) 为键, 按环形顺序替换
+typedef struct {
+  const vlist_t *list; // NULL 表示空项
+  uint16_t index;
+  vitem_t item;
+  char text[VLIST_ROW_TEXT_LEN];
+} vlist_row_t;
+
+static vlist_row_t g_vlist_rows[VLIST_ROW_CACHE_SIZE];
+static uint8_t g_vlist_row_next; // 下一个被替换的项
+
+/**
+ * @brief 取第 index 行: 普通列表直接返回 items, 虚拟列表先查行缓存, 未命中时调用 provider
+ * @note  虚拟列表返回的行在下一次未命中时可能被替换, 不要同时持有两行
+ */
+static vitem_t *vlist_item(vlist_t *list, int index) {
+  if (list->provider == NULL) return &list->items[index];
+
+  for (uint8_t i = 0; i < VLIST_ROW_CACHE_SIZE; i++) {
+    vlist_row_t *r = &g_vlist_rows[i];
+    if (r->list == list && r->index == index) return &r->item;
+  }
+
+  vlist_row_t *r = &g_vlist_rows[g_vlist_row_next];
+  g_vlist_row_next = (g_vlist_row_next + 1) % VLIST_ROW_CACHE_SIZE;
+  memset(&r->item, 0, sizeof(r->item));
+  r->text[0] = '\0';
+  str_width_invalidate(r->text); // 缓冲区地址不变, 内容换成了另一行
+  r->list = list;
+  r->index = (uint16_t)index;
+  list->provider(list->provider_ctx, r->index, &r->item, r->text, sizeof(r->text));
+  return &r->item;
+}
+
+// 行布局: 与滚动位置无关的部分, 以 (列表, 行号, 字体) 为键, 数值类型另比较数值快照
+typedef struct {
+  const vlist_t *list; // NULL 表示空项
+  uint16_t index;
+  const uint8_t *font;
+  float value;          // 数值快照 (VITEM_NUM_EDIT / VITEM_PRECISE_EDIT)
+  const char *prefix;   // 前缀
+  uint8_t title_w;      // 标题宽度
+  uint8_t right_w;      // 右侧元素宽度
+  uint8_t right_x;      // 右侧元素起点
+  uint8_t avail_w;      // 非高亮时标题的可用宽度
+  char value_text[16];  // 数值文本, 空串表示没有
+} vlist_layout_t;
+
+#if VLIST_LAYOUT_SLOTS
+static vlist_layout_t g_vlist_layouts[VLIST_LAYOUT_SLOTS]; // 按行号直接映射
+#else
+static vlist_layout_t g_vlist_layout_tmp;
+#endif
+
 /**
- * @brief ߺȡҲԪؿ
- * @return ȣu8
+ * @brief 丢弃该列表已缓存的行布局
+ */
+static void vlist_layout_drop(const vlist_t *list) {
+#if VLIST_LAYOUT_SLOTS
+  for (uint8_t i = 0; i < VLIST_LAYOUT_SLOTS; i++)
+    if (g_vlist_layouts[i].list == list) g_vlist_layouts[i].list = NULL;
+#else
+  (void)list;
+#endif
+}
+
+/**
+ * @brief 工具函数，获取右侧元素宽度
+ * @return 宽度（u8）
  */
 static uint8_t get_right_item_width(u8g2_t *u8g2, const Screen_t *screen_cfg,
                                     const vitem_t *item) {
@@ -27,7 +94,7 @@ static uint8_t get_right_item_width(u8g2_t *u8g2, const Screen_t *screen_cfg,
     if (item->user_data == NULL)
       return screen_cfg->num_min_width;
     char buf[16];
-    sprintf(buf, "%.1f", *(float *)item->user_data);
+    num_fmt_float(buf, sizeof(buf), *(float *)item->user_data, 1, 0);
     int num_width = u8g2_GetStrWidth(u8g2, buf);
     return (num_width > screen_cfg->num_min_width ? num_width
                                                   : screen_cfg->num_min_width);
@@ -36,7 +103,7 @@ static uint8_t get_right_item_width(u8g2_t *u8g2, const Screen_t *screen_cfg,
     if (item->user_data == NULL)
       return screen_cfg->num_min_width;
     char buf[16];
-    sprintf(buf, "%u", *(uint16_t *)item->user_data);
+    num_fmt_uint(buf, sizeof(buf), *(uint16_t *)item->user_data, 0);
     int num_width = u8g2_GetStrWidth(u8g2, buf);
     return (num_width > screen_cfg->num_min_width ? num_width
                                                   : screen_cfg->num_min_width);
@@ -55,8 +122,49 @@ static uint8_t get_right_item_width(u8g2_t *u8g2, const Screen_t *screen_cfg,
   }
 }
 
+static bool vlist_has_value(const vitem_t *item) {
+  return (item->type == VITEM_NUM_EDIT || item->type == VITEM_PRECISE_EDIT) && item->user_data != NULL;
+}
+
 /**
- * @brief  Ļ߼
+ * @brief 取第 index 行的布局, 内容未变化时直接返回缓存
+ * @note  调用前需设置好列表字体
+ */
+static const vlist_layout_t *vlist_layout(u8g2_t *u8g2, const Screen_t *screen_cfg,
+                                          vlist_t *list, int index, const vitem_t *item) {
+  float value = vlist_has_value(item) ? *(float *)item->user_data : 0.0f;
+#if VLIST_LAYOUT_SLOTS
+  vlist_layout_t *lay = &g_vlist_layouts[index % VLIST_LAYOUT_SLOTS];
+  if (lay->list == list && lay->index == index &&
+      lay->font == u8g2->font && lay->value == value)
+    return lay;
+#else
+  vlist_layout_t *lay = &g_vlist_layout_tmp;
+#endif
+
+  lay->list = list;
+  lay->index = (uint16_t)index;
+  lay->font = u8g2->font;
+  lay->value = value;
+
+  lay->prefix = "";
+  if (item->type == VITEM_SUBMENU || item->type == VITEM_PROTECTED_SUBMENU) lay->prefix = PREFIX_SUBMENU;
+  else if (item->type == VITEM_ACTION || item->type == VITEM_PROTECTED_ACTION) lay->prefix = PREFIX_ACTION;
+  else if (item->type == VITEM_PROGRESS) lay->prefix = PREFIX_PROGRESS;
+
+  lay->title_w = str_width_get(u8g2, item->title);
+  lay->right_w = get_right_item_width(u8g2, screen_cfg, item);
+  lay->right_x = screen_cfg->width - lay->right_w - screen_cfg->right_item_margin;
+  lay->avail_w = lay->right_x - screen_cfg->title_left_margin - 5;
+
+  lay->value_text[0] = '\0';
+  if (vlist_has_value(item)) num_fmt_float(lay->value_text, sizeof(lay->value_text), value, 1, 0);
+  str_width_invalidate(lay->value_text); // 缓冲区地址不变, 内容可能已改变
+  return lay;
+}
+
+/**
+ * @brief  核心绘制逻辑
  *
  * @param[in]  a
  * @param[in]  b
@@ -70,71 +178,99 @@ void vlist_draw(u8g2_t *u8g2, void *ctx) {
   const Screen_t *screen_cfg = &g_screen_cfg;
   if (list->count == 0) return;
 
+#if UI_FIXED_MATH
+  q16_t p = fix_progress(*list->main_tick - list->start_tick, screen_cfg->animation_duration);
+  q16_t ease_p = EASING_Q16(VLIST_ANIM_FUC)(p);
+  if (p < Q16_ONE) page_stack_request_frame(&g_page_stack);
+  // 高亮行的 y 坐标 (像素), provider 列表的行号可超过 Q16 的整数范围, 不先转成 Q16 行号
+  int ease_y = fix_lerp_scale(list->from_index, list->to_index, ease_p, screen_cfg->font_height + 3);
+
+  // 绘制右侧滚动条
+  u8g2_SetDrawColor(u8g2, 1);
+  int from_bar_len = 64 * (list->from_index + 1) / list->count;
+  int to_bar_len = 64 * (list->to_index + 1) / list->count;
+  int curr_bar_len = fix_to_int(fix_lerp_int(from_bar_len, to_bar_len, ease_p));
+#else
   float p = fminf((float)(*list->main_tick - list->start_tick) / screen_cfg->animation_duration, 1.0f);
   float ease_p = VLIST_ANIM_FUC(p);
-  float ease_idx = list->from_index + (list->to_index - list->from_index) * ease_p;
-
-  // ƫƼ
-  int scroll_y = 0;
-  if (ease_idx > 3.0f) {
-    scroll_y = (int)((ease_idx - 3.0f) * (screen_cfg->font_height + 3));
-  }
+  if (p < 1.0f) page_stack_request_frame(&g_page_stack);
+  // 高亮行的 y 坐标 (像素), 只对行号的变化量插值: 行号很大时 float 的精度不足以表示小数部分
+  int ease_y = list->from_index * (screen_cfg->font_height + 3) +
+               (int)floorf((list->to_index - list->from_index) * ease_p * (screen_cfg->font_height + 3));
 
-  // Ҳ
+  // 绘制右侧滚动条
   u8g2_SetDrawColor(u8g2, 1);
   int from_bar_len = (int)(64.0f * ((float)(list->from_index + 1) / list->count));
   int to_bar_len = (int)(64.0f * ((float)(list->to_index + 1) / list->count));
   int curr_bar_len = (int)(from_bar_len + (to_bar_len - from_bar_len) * ease_p);
+#endif
   u8g2_DrawVLine(u8g2, screen_cfg->width - 1, 0, curr_bar_len);
 
+  // 滚动偏移计算
+  int scroll_y = 0;
+  if (ease_y > 3 * (screen_cfg->font_height + 3)) {
+    scroll_y = ease_y - 3 * (screen_cfg->font_height + 3);
+  }
+
   u8g2_SetFont(u8g2, screen_cfg->font);
 
-  for (int i = 0; i < list->count; i++) {
-    vitem_t *curr_item = &list->items[i];
-    int item_y = (i * (screen_cfg->font_height + 3)) - scroll_y + screen_cfg->font_baseline + 2;
+  // 高亮框动画起点的宽度. 在遍历可见行之前取出: 虚拟列表中取其它行可能替换掉正在绘制的行
+  int from_title_w = -1;
+  if (list->from_index >= 0 && list->from_index < list->count) {
+    from_title_w = str_width_get(u8g2, vlist_item(list, list->from_index)->title);
+  }
+
+  // 由滚动偏移直接算出可见行的范围, 只遍历这些行
+  int row_h = screen_cfg->font_height + 3;
+  int row_y0 = screen_cfg->font_baseline + 2; // 第 0 行的基线
+  int first_y = scroll_y - screen_cfg->font_height - row_y0;
+  int first = (first_y > 0) ? (first_y + row_h - 1) / row_h : 0;
+  int last = (scroll_y + screen_cfg->height + 10 - row_y0) / row_h;
+  if (last > list->count - 1) last = list->count - 1;
+
+  for (int i = first; i <= last; i++) {
+    vitem_t *curr_item = vlist_item(list, i);
+    int item_y = (i * row_h) - scroll_y + row_y0;
 
     if (item_y < -screen_cfg->font_height || item_y > screen_cfg->height + 10) continue;
-    uint8_t right_item_w = get_right_item_width(u8g2, screen_cfg, curr_item);
-    uint8_t right_item_x = screen_cfg->width - right_item_w - screen_cfg->right_item_margin;
-    uint8_t base_avail_width = right_item_x - screen_cfg->title_left_margin - 5;
+    const vlist_layout_t *lay = vlist_layout(u8g2, screen_cfg, list, i, curr_item);
+    uint8_t right_item_w = lay->right_w;
+    uint8_t right_item_x = lay->right_x;
+    uint8_t base_avail_width = lay->avail_w;
 
     bool is_highlighted = (i == list->to_index);
     uint8_t clip_y1, clip_y2;
 
     if (is_highlighted) {
-      int box_y = (int)(ease_idx * (screen_cfg->font_height + 3)) - scroll_y + 2;
-      int target_w = u8g2_GetStrWidth(u8g2, curr_item->title) + screen_cfg->highlight_padding;
-      int start_w = 20;
-      if (list->from_index >= 0 && list->from_index < list->count) {
-          start_w = u8g2_GetStrWidth(u8g2, list->items[list->from_index].title) + screen_cfg->highlight_padding;
-      }
+      int box_y = ease_y - scroll_y + 2;
+      int target_w = lay->title_w + screen_cfg->highlight_padding;
+      int start_w = (from_title_w >= 0) ? from_title_w + screen_cfg->highlight_padding : 20;
 
-      // ƲҲԪ
+      // 限制不超出右侧元素
       int max_w = right_item_x - screen_cfg->title_left_margin + (screen_cfg->highlight_padding / 2);
       if (target_w > max_w) target_w = max_w;
       if (start_w > max_w) start_w = max_w;
 
+#if UI_FIXED_MATH
+      int cur_box_w = fix_to_int(fix_lerp_int(start_w, target_w, ease_p));
+#else
       int cur_box_w = (int)(start_w + (target_w - start_w) * ease_p);
+#endif
       int box_x = screen_cfg->title_left_margin - (screen_cfg->highlight_padding / 2);
 
-      // Ƹ
+      // 绘制高亮背景
       u8g2_SetDrawColor(u8g2, 1);
       u8g2_DrawRBox(u8g2, box_x, box_y, cur_box_w, screen_cfg->highlight_height, g_screen_cfg.hightlight_radius);
 
-      int text_clip_x = box_x + 2;
       int text_clip_w = cur_box_w - 8;
       clip_y1 = box_y + 1;
       clip_y2 = box_y + screen_cfg->highlight_height - 1;
 
-      // ǰ׺
+      // 绘制前缀
       u8g2_SetDrawColor(u8g2, 0);
-      const char* prefix = "";
-      if (curr_item->type == VITEM_SUBMENU || curr_item->type == VITEM_PROTECTED_SUBMENU) prefix = PREFIX_SUBMENU;
-      else if (curr_item->type == VITEM_ACTION || curr_item->type == VITEM_PROTECTED_ACTION) prefix = PREFIX_ACTION;
-      else if (curr_item->type == VITEM_PROGRESS) prefix = PREFIX_PROGRESS;
-      g_screen_cfg.draw_text(u8g2, 5, item_y, prefix);
+      g_screen_cfg.draw_text(u8g2, 5, item_y, lay->prefix);
 
-      // Ʊ
+      // 绘制标题
       draw_scroll_text_with_pause(u8g2, screen_cfg, curr_item->title, 
                                   screen_cfg->title_left_margin, text_clip_w, 
                                   item_y, *list->main_tick, clip_y1, clip_y2);
@@ -143,35 +279,29 @@ void vlist_draw(u8g2_t *u8g2, void *ctx) {
       clip_y1 = item_y - screen_cfg->font_height + 2;
       clip_y2 = item_y + 2;
 
-      const char* prefix = "";
-      if (curr_item->type == VITEM_SUBMENU || curr_item->type == VITEM_PROTECTED_SUBMENU) prefix = PREFIX_SUBMENU;
-      else if (curr_item->type == VITEM_ACTION || curr_item->type == VITEM_PROTECTED_ACTION) prefix = PREFIX_ACTION;
-      else if (curr_item->type == VITEM_PROGRESS) prefix = PREFIX_PROGRESS;
-      g_screen_cfg.draw_text(u8g2, 5, item_y, prefix);
+      g_screen_cfg.draw_text(u8g2, 5, item_y, lay->prefix);
 
       draw_scroll_text_with_pause(u8g2, screen_cfg, curr_item->title, 
                                   screen_cfg->title_left_margin, base_avail_width, 
                                   item_y, *list->main_tick, clip_y1, clip_y2);
     }
 
-    // --- ҲཻԪ---
-    u8g2_SetDrawColor(u8g2, 1); // ָɫ
+    // --- 绘制右侧交互元素---
+    u8g2_SetDrawColor(u8g2, 1); // 恢复颜色
     if (curr_item->type == VITEM_CLICK && curr_item->user_data != NULL) {
       bool v = *(bool *)curr_item->user_data;
       if (v) u8g2_DrawBox(u8g2, right_item_x, item_y - 8, 6, 6);
       else u8g2_DrawFrame(u8g2, right_item_x, item_y - 8, 6, 6);
     } 
-    else if ((curr_item->type == VITEM_NUM_EDIT || curr_item->type == VITEM_PRECISE_EDIT) && curr_item->user_data != NULL) {
-      char b[16];
-      sprintf(b, "%.1f", *(float *)curr_item->user_data);
-      draw_scroll_text_with_pause(u8g2, screen_cfg, b, right_item_x, right_item_w, 
+    else if (lay->value_text[0] != '\0') {
+      draw_scroll_text_with_pause(u8g2, screen_cfg, lay->value_text, right_item_x, right_item_w, 
                                   item_y, *list->main_tick, clip_y1, clip_y2);
     }
   }
 }
 
 /**
- * @brief  ʼ/עắ
+ * @brief  初始化/注册函数
  *
  * @param[in]  a
  * @param[in]  b
@@ -184,6 +314,7 @@ void vlist_init(vlist_t *list, uint32_t *tick_ptr) {
   }
 
   memset(list, 0, sizeof(vlist_t));
+  vlist_layout_drop(list); // 重新初始化的列表不能沿用之前的布局
   list->main_tick = tick_ptr;
   list->from_index = 0;
   list->to_index = 0;
@@ -193,6 +324,39 @@ void vlist_init(vlist_t *list, uint32_t *tick_ptr) {
   list->alert.text = NULL;
 }
 
+void vlist_init_provider(vlist_t *list, uint32_t *tick_ptr, uint16_t count,
+                         vlist_provider_t provider, void *ctx) {
+  if (list == NULL || tick_ptr == NULL || provider == NULL) {
+    return;
+  }
+
+  vlist_init(list, tick_ptr);
+  list->provider = provider;
+  list->provider_ctx = ctx;
+  vlist_provider_reload(list, count);
+}
+
+void vlist_provider_reload(vlist_t *list, uint16_t count) {
+  if (list == NULL) {
+    return;
+  }
+
+  for (uint8_t i = 0; i < VLIST_ROW_CACHE_SIZE; i++)
+    if (g_vlist_rows[i].list == list) g_vlist_rows[i].list = NULL;
+  vlist_invalidate_layout(list);
+
+  list->count = count;
+  if (list->to_index >= count) list->to_index = count > 0 ? count - 1 : 0;
+  if (list->from_index >= count) list->from_index = list->to_index;
+}
+
+void vlist_invalidate_layout(vlist_t *list) {
+  if (list == NULL) {
+    return;
+  }
+  vlist_layout_drop(list);
+}
+
 void vlist_add_action(vlist_t *list, const char *title,
                       const page_component_t *comp, void *ctx) {
   if (list == NULL || title == NULL || comp == NULL) {
@@ -345,13 +509,13 @@ void vlist_add_protected_progress(vlist_t *list, const char *title,
   vitem_t *it = &list->items[list->count++];
   it->title = title;
   it->type = VITEM_PROGRESS;
-  it->callback = (void (*)(void *))cb; //  callback ָ
+  it->callback = (void (*)(void *))cb; // 借用 callback 指针存任务函数
 }
 
 #endif
 
 /**
- * @brief  봦
+ * @brief  输入处理函数
  *
  * @param[in]  a
  * @param[in]  b
@@ -364,15 +528,18 @@ void vlist_input_handler(int btn, void *ctx) {
 
   vlist_t *list = (vlist_t *)ctx;
 
-  // ¼
+  // 处理上下键滚动, 多步输入 (编码器快速转动) 一次移动多项, 只播放一次动画
+  int steps = btn_get_steps(btn);
+  btn = btn_get_type(btn);
   bool animation_triggered = false;
   if (btn == BTN_UP && list->to_index > 0) {
     list->from_index = list->to_index;
-    list->to_index--;
+    list->to_index = list->to_index > steps ? list->to_index - steps : 0;
     animation_triggered = true;
   } else if (btn == BTN_DOWN && list->to_index < list->count - 1) {
     list->from_index = list->to_index;
-    list->to_index++;
+    list->to_index = list->count - 1 - list->to_index > steps ? list->to_index + steps
+                                                              : list->count - 1;
     animation_triggered = true;
   }
 
@@ -381,15 +548,15 @@ void vlist_input_handler(int btn, void *ctx) {
     return;
   }
 
-  // ؼ
+  // 处理返回键
   if (btn == BTN_BACK) {
     page_stack_pop(&g_page_stack);
     return;
   }
 
-  // ȷϼ
-  if (btn == BTN_ENTER) {
-    vitem_t *it = &list->items[list->to_index];
+  // 处理确认键
+  if (btn == BTN_ENTER && list->count > 0) {
+    vitem_t *it = vlist_item(list, list->to_index);
     switch (it->type) {
     case VITEM_CLICK:
       if (it->user_data)
@@ -398,7 +565,7 @@ void vlist_input_handler(int btn, void *ctx) {
     case VITEM_NUM_EDIT:
       page_stack_portal_toggle(&g_page_stack, &PORTAL_NUM,
                                &(portal_ctx_num_t){
-                                   .title = "num_select",
+                                   .title = it->title,
                                    .val_ptr = (float *)it->user_data,
                                    .min = -100,
                                    .max = 100,
@@ -438,7 +605,7 @@ void vlist_input_handler(int btn, void *ctx) {
         page_stack_push(&g_page_stack, action_data->comp, action_data->ctx);
       }
       break;
-    // ڴ߼
+    // 带保护的组件入口处理逻辑
     case VITEM_PROTECTED_ACTION:
       if (it->user_data) {
         vlist_protected_action_data_t *prot_action =
@@ -488,4 +655,5 @@ void vlist_input_handler(int btn, void *ctx) {
   }
 }
 
-const page_component_t VLIST_COMP = {vlist_draw, vlist_input_handler};
\ No newline at end of file
+const page_component_t VLIST_COMP = {
+    .draw = vlist_draw, .input = vlist_input_handler, .multi_step = true};
\ No newline at end of file
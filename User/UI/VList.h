@@ -8,41 +8,48 @@
 #include "screen.h"
 #include "ui_toolkit.h"
 
-// ==========   ==========
+// ========== 配置项  ==========
 #define MAX_LIST_ITEMS 16
 #define VLIST_ITEM_H 14
 #define VLIST_ANIM_FUC QuadraticEaseOut
+// 虚拟列表的行缓存: 所有虚拟列表共用, 项数不少于一屏可见行数 + 1
+#define VLIST_ROW_CACHE_SIZE 8
+#define VLIST_ROW_TEXT_LEN 24 // 每行文本缓冲区长度
+// 行布局缓存 (所有列表共用): 前缀、标题与右侧元素宽度、数值文本只在内容变化时重新计算
+#ifndef VLIST_LAYOUT_SLOTS
+#define VLIST_LAYOUT_SLOTS 8 // 不少于一屏可见行数, 为 0 时每帧重新计算
+#endif
 
 extern const Screen_t g_screen_cfg;
 
 typedef enum {
-  VITEM_CLICK = 0,         // ť
-  VITEM_NUM_EDIT,          // 
-  VITEM_SUBMENU,           // Ӳ˵
-  VITEM_ACTION,            // 
-  VITEM_PLAIN_TEXT,        // ı
-  VITEM_PROTECTED_SUBMENU, // Ӳ˵
-  VITEM_PROTECTED_ACTION,  // 
-  VITEM_PRECISE_EDIT,      // λ
+  VITEM_CLICK = 0,         // 按钮
+  VITEM_NUM_EDIT,          // 数字
+  VITEM_SUBMENU,           // 子菜单
+  VITEM_ACTION,            // 组件入口
+  VITEM_PLAIN_TEXT,        // 纯文本
+  VITEM_PROTECTED_SUBMENU, // 带保护的子菜单
+  VITEM_PROTECTED_ACTION,  // 带保护的组件入口
+  VITEM_PRECISE_EDIT,      // 按位调整整形
   VITEM_PROGRESS
 } vitem_type_t;
 
 typedef struct {
-  const page_component_t *comp; // Ŀ
-  void *ctx;                    // 
+  const page_component_t *comp; // 目标组件
+  void *ctx;                    // 组件上下文
 } vlist_action_data_t;
 
 typedef struct {
-  vlist_action_data_t action_data; // ת
-  bool guard_flag;                 // ־
-  char *alert_title;               // ʾ
-  char *alert_text;                // ʾı
+  vlist_action_data_t action_data; // 组件跳转数据
+  bool guard_flag;                 // 保护标志
+  char *alert_title;               // 保护提示标题
+  char *alert_text;                // 保护提示文本
 } vlist_protected_action_data_t;
 
 typedef struct {
   const char *title;
   vitem_type_t type;
-  void *user_data; // ͬͶӦͬݣ
+  void *user_data; // 不同类型对应不同数据：
                    // - VITEM_CLICK: bool*
                    // - VITEM_NUM_EDIT: float*
                    // - VITEM_SUBMENU/VITEM_PROTECTED_SUBMENU: vlist_t*
@@ -51,33 +58,46 @@ typedef struct {
                    // - VITEM_PLAIN_TEXT: NULL
   float min, max, step;
   void (*callback)(void *ctx);
-  // Ӳ˵չֶ
-  bool guard_flag;     // ־
-  char *alert_title;   // ʾ
-  char *alert_text;    // ʾı
-  uint8_t total_digit; // ʾλ
-  uint8_t dot_pos;     // Сλ
+  // 保护子菜单扩展字段
+  bool guard_flag;     // 保护标志
+  char *alert_title;   // 保护提示标题
+  char *alert_text;    // 保护提示文本
+  uint8_t total_digit; // 总显示位数
+  uint8_t dot_pos;     // 小数点位置
 } vitem_t;
 
+/**
+ * @brief 虚拟列表的行数据回调, 只在第 index 行需要显示或被选中时调用
+ * @param item 已清零, 按 vlist_add_* 的方式填写 type/user_data 等字段
+ * @param buf  该行独占的文本缓冲区 (长度 buf_size), 标题可以写在这里并令 item->title = buf;
+ *             行被移出缓存之前内容保持不变
+ */
+typedef void (*vlist_provider_t)(void *ctx, uint16_t index, vitem_t *item, char *buf,
+                                 uint8_t buf_size);
+
 typedef struct {
-  vitem_t items[MAX_LIST_ITEMS];
-  uint8_t count;
+  vitem_t items[MAX_LIST_ITEMS]; // provider 不为 NULL 时不使用
+  uint16_t count;
   int from_index;
   int to_index;
   uint32_t start_tick;
   uint32_t *main_tick;
 
-  // ֱ༭״̬
+  // 虚拟列表: 行数据由回调按需提供
+  vlist_provider_t provider;
+  void *provider_ctx;
+
+  // 数字编辑器状态
   struct {
     bool active;
     int target_idx;
   } editor;
 
-  // ʾ״̬
+  // 提示弹窗状态
   struct {
-    bool active; // Ƿ񼤻
-    char *title; // ʾ
-    char *text;  // ʾı
+    bool active; // 弹窗是否激活
+    char *title; // 提示标题
+    char *text;  // 提示文本
   } alert;
 } vlist_t;
 
@@ -90,7 +110,7 @@ typedef struct {
     portal_progress_force_refresh(p);                                          \
   } while (0)
 
-// 2. ɹ
+// 2. 标记任务成功完成
 #define PROGRESS_SET_SUCCESS(p)                                                \
   do {                                                                         \
     (p)->status = PROG_STATUS_SUCCESS;                                         \
@@ -98,7 +118,7 @@ typedef struct {
     portal_progress_force_refresh(p);                                          \
   } while (0)
 
-// 3. ʧܲʾԭ
+// 3. 标记任务失败并显示原因
 #define PROGRESS_SET_FAILED(p, _reason)                                        \
   do {                                                                         \
     (p)->status = PROG_STATUS_FAIL;                                            \
@@ -118,7 +138,7 @@ void vlist_add_protected_progress(vlist_t *list, const char *title,
 
 extern const page_component_t VLIST_COMP;
 
-// עắ
+// 注册函数
 void vlist_init(vlist_t *list, uint32_t *tick_ptr);
 void vlist_add_toggle(vlist_t *list, const char *title, bool *val);
 void vlist_add_num(vlist_t *list, const char *title, float *val, float min,
@@ -138,4 +158,23 @@ void vlist_add_precise_num(vlist_t *list, const char *title, float *val,
                            float min, float max, uint8_t total_digit,
                            uint8_t dot_pos);
 
+/**
+ * @brief 初始化为虚拟列表: 不占用 items, 绘制时只向 provider 请求可见的行,
+ *        耗时与列表长度无关
+ * @param count 行数
+ */
+void vlist_init_provider(vlist_t *list, uint32_t *tick_ptr, uint16_t count,
+                         vlist_provider_t provider, void *ctx);
+
+/**
+ * @brief 虚拟列表的数据变化后调用: 更新行数并丢弃该列表已缓存的行
+ */
+void vlist_provider_reload(vlist_t *list, uint16_t count);
+
+/**
+ * @brief 直接修改了已有行的标题或类型后调用, 使该列表的行布局重新计算.
+ *        数值变化、字体变化与 vlist_add_* 会自动检测, 不需要调用
+ */
+void vlist_invalidate_layout(vlist_t *list);
+
 #endif
\ No newline at end of file
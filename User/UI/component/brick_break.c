@@ -1,10 +1,11 @@
 #include "brick_break.h"
 #include "u8g2.h"
+#include "ui_toolkit.h"
 #include <string.h>
 #include <stdint.h>
 
 /**
- * @brief ʼש鲼
+ * @brief 初始化砖块布局
  */
 static void init_bricks(brick_break_ctx_t *ctx) {
     if (ctx == NULL) return;
@@ -23,28 +24,28 @@ static void init_bricks(brick_break_ctx_t *ctx) {
 }
 
 /**
- * @brief Ϸ״̬
+ * @brief 重置游戏状态
  */
 static void reset_game(brick_break_ctx_t *ctx) {
     if (ctx == NULL) return;
     
-    // 
+    // 挡板居中
     ctx->paddle_x = (ctx->screen->width - PADDLE_WIDTH) / 2;
     ctx->paddle_y = ctx->screen->height - 10;
     
-    // СʼλڵϷ
+    // 小球初始位置在挡板上方
     ctx->ball_x = ctx->paddle_x + PADDLE_WIDTH / 2 - BALL_SIZE / 2;
     ctx->ball_y = ctx->paddle_y - BALL_SIZE - 1;
     ctx->ball_dir_x = BALL_SPEED_X;
     ctx->ball_dir_y = -BALL_SPEED_Y; 
-    ctx->ball_tick = 0;
+    ctx->ball_tick = *ctx->main_tick;
     
     init_bricks(ctx);
     ctx->state = GAME_STATE_READY;
 }
 
 /**
- * @brief ײ⣺Сש
+ * @brief 碰撞检测：小球与砖块
  */
 static void check_brick_collision(brick_break_ctx_t *ctx) {
     if (ctx == NULL || ctx->state != GAME_STATE_PLAYING) return;
@@ -54,16 +55,16 @@ static void check_brick_collision(brick_break_ctx_t *ctx) {
             brick_t *brick = &ctx->bricks[row][col];
             if (!brick->active) continue;
             
-            // ȷײ
+            // 精确碰撞检测
             if (ctx->ball_x + BALL_SIZE > brick->x &&
                 ctx->ball_x < brick->x + BRICK_WIDTH &&
                 ctx->ball_y + BALL_SIZE > brick->y &&
                 ctx->ball_y < brick->y + BRICK_HEIGHT) {
                 
                 brick->active = false;
-                ctx->ball_dir_y = -ctx->ball_dir_y; // ֱ
+                ctx->ball_dir_y = -ctx->ball_dir_y; // 垂直反弹
                 
-                // ʤ
+                // 检查胜利条件
                 bool all_broken = true;
                 for (uint8_t r = 0; r < BRICK_ROWS && all_broken; r++) {
                     for (uint8_t c = 0; c < BRICK_COLS && all_broken; c++) {
@@ -78,12 +79,12 @@ static void check_brick_collision(brick_break_ctx_t *ctx) {
 }
 
 /**
- * @brief ײ⣺С߽/
+ * @brief 碰撞检测：小球与边界/挡板
  */
 static void check_boundary_collision(brick_break_ctx_t *ctx) {
     if (ctx == NULL || ctx->state != GAME_STATE_PLAYING) return;
     
-    // ұ߽練
+    // 左右边界反弹
     if (ctx->ball_x <= 0) {
         ctx->ball_x = 0;
         ctx->ball_dir_x = BALL_SPEED_X;
@@ -92,26 +93,26 @@ static void check_boundary_collision(brick_break_ctx_t *ctx) {
         ctx->ball_dir_x = -BALL_SPEED_X;
     }
     
-    // ϱ߽練
+    // 上边界反弹
     if (ctx->ball_y <= 0) {
         ctx->ball_y = 0;
         ctx->ball_dir_y = BALL_SPEED_Y;
     }
     
-    // ±߽磺Ϸ
+    // 下边界：游戏结束
     if (ctx->ball_y + BALL_SIZE >= ctx->screen->height) {
         ctx->state = GAME_STATE_GAME_OVER;
         return;
     }
     
-    // ײǶŻ
+    // 挡板碰撞（带角度优化）
     if (ctx->ball_y + BALL_SIZE >= ctx->paddle_y &&
         ctx->ball_x + BALL_SIZE > ctx->paddle_x &&
         ctx->ball_x < ctx->paddle_x + PADDLE_WIDTH) {
         ctx->ball_y = ctx->paddle_y - BALL_SIZE;
         ctx->ball_dir_y = -BALL_SPEED_Y;
         
-        // ײλӰX
+        // 碰撞位置影响X方向
         uint8_t hit_center = ctx->paddle_x + PADDLE_WIDTH / 2;
         if (ctx->ball_x + BALL_SIZE/2 < hit_center - 5) {
             ctx->ball_dir_x = -BALL_SPEED_X;
@@ -122,48 +123,53 @@ static void check_boundary_collision(brick_break_ctx_t *ctx) {
 }
 
 /**
- * @brief Ϸ߼£ÿ֡ã
+ * @brief 游戏逻辑更新（每帧调用）
  */
 static void update_game_logic(brick_break_ctx_t *ctx) {
     if (ctx == NULL || ctx->state != GAME_STATE_PLAYING) return;
     
-    // tickƵСٶȣƶ
-    ctx->ball_tick++;
-    if (ctx->ball_tick >= BALL_SPEED_DIVISOR) {
+    // 页面重新显示时（返回后再进入、portal 或其它页面遮挡期间不绘制），不补走这段时间
+    if (*ctx->main_tick - ctx->ball_tick >= BALL_MAX_STEPS * BALL_STEP_MS) {
+        ctx->ball_tick = *ctx->main_tick - BALL_STEP_MS;
+    }
+
+    // 按经过的时间移动小球，速度与帧率无关
+    while (ctx->state == GAME_STATE_PLAYING &&
+           *ctx->main_tick - ctx->ball_tick >= BALL_STEP_MS) {
         ctx->ball_x += ctx->ball_dir_x;
         ctx->ball_y += ctx->ball_dir_y;
-        ctx->ball_tick = 0;
+        ctx->ball_tick += BALL_STEP_MS;
         
-        // ײ
+        // 碰撞检测
         check_boundary_collision(ctx);
         check_brick_collision(ctx);
     }
+    page_stack_request_frame(&g_page_stack);
 }
 
 /**
- * @brief Ϸ棨߼£
+ * @brief 绘制游戏界面（整合逻辑更新）
  */
 static void brick_break_draw(u8g2_t *u8g2, void *ctx) {
     if (u8g2 == NULL || ctx == NULL) return;
     
     brick_break_ctx_t *game_ctx = (brick_break_ctx_t *)ctx;
     
-    // ========== ÿ֡Ϸ߼ ==========
+    // ========== 每帧更新游戏逻辑 ==========
     update_game_logic(game_ctx);
 
-    u8g2_ClearBuffer(u8g2);
     const Screen_t *screen = game_ctx->screen;
     
-    // ========== Ƶ ==========
+    // ========== 绘制挡板 ==========
     u8g2_SetDrawColor(u8g2, 1);
     u8g2_DrawBox(u8g2, game_ctx->paddle_x, game_ctx->paddle_y, 
                  PADDLE_WIDTH, PADDLE_HEIGHT);
     
-    // ========== С ==========
+    // ========== 绘制小球 ==========
     u8g2_DrawBox(u8g2, game_ctx->ball_x, game_ctx->ball_y, 
                  BALL_SIZE, BALL_SIZE);
     
-    // ========== ש ==========
+    // ========== 绘制砖块 ==========
     for (uint8_t row = 0; row < BRICK_ROWS; row++) {
         for (uint8_t col = 0; col < BRICK_COLS; col++) {
             brick_t *brick = &game_ctx->bricks[row][col];
@@ -174,7 +180,7 @@ static void brick_break_draw(u8g2_t *u8g2, void *ctx) {
         }
     }
     
-    // ========== Ϸ״̬ı ==========
+    // ========== 绘制游戏状态文本 ==========
     u8g2_SetFont(u8g2, screen->font);
     const char *status_text = NULL;
     switch (game_ctx->state) {
@@ -193,36 +199,34 @@ static void brick_break_draw(u8g2_t *u8g2, void *ctx) {
     }
     
     if (status_text != NULL) {
-        uint8_t text_width = u8g2_GetStrWidth(u8g2, status_text);
+        uint8_t text_width = str_width_get(u8g2, status_text);
         u8g2_DrawStr(u8g2, (screen->width - text_width) / 2, 
                      screen->height / 2, status_text);
     }
     
-    // ========== Ʋʾ ==========
+    // ========== 绘制操作提示 ==========
     u8g2_SetFont(u8g2, u8g2_font_5x7_tf);
     const char *hint_text = "LEFT/RIGHT:Move  BACK:Exit";
-    uint8_t hint_width = u8g2_GetStrWidth(u8g2, hint_text);
+    uint8_t hint_width = str_width_get(u8g2, hint_text);
     u8g2_DrawStr(u8g2, (screen->width - hint_width) / 2, 
                  screen->height - 5, hint_text);
-    
-    u8g2_SendBuffer(u8g2);
 }
 
 /**
- * @brief ޸֧ƶ
+ * @brief 修复按键处理：支持连续移动
  */
 static void brick_break_input(int btn, void *ctx) {
     if (ctx == NULL) return;
     
     brick_break_ctx_t *game_ctx = (brick_break_ctx_t *)ctx;
     
-    // ˳Ϸ
+    // 退出游戏
     if (btn == BTN_BACK) {
         page_stack_pop(&g_page_stack);
         return;
     }
 
-    // ״̬
+    // 状态控制
     switch (game_ctx->state) {
         case GAME_STATE_READY:
         case GAME_STATE_GAME_OVER:
@@ -234,10 +238,10 @@ static void brick_break_input(int btn, void *ctx) {
             break;
             
         case GAME_STATE_PLAYING:
-            // ƶֱ޸꣬ÿһ֡ˢ
+            // 挡板连续移动：直接修改坐标，每一帧都会刷新
             if (btn == BTN_UP && game_ctx->paddle_x > 0) {
                 game_ctx->paddle_x -= PADDLE_SPEED;
-                // ޸ʹgame_ctxctxж߼
+                // 修复：使用game_ctx而非ctx，且修正溢出判断逻辑
                 if (game_ctx->paddle_x > game_ctx->screen->width) { 
                     game_ctx->paddle_x = 0;
                 }
@@ -253,7 +257,7 @@ static void brick_break_input(int btn, void *ctx) {
 }
 
 /**
- * @brief ʼϷ
+ * @brief 初始化游戏上下文
  */
 void brick_break_init(brick_break_ctx_t *ctx, uint32_t *main_tick, const Screen_t *screen) {
     if (ctx == NULL || main_tick == NULL || screen == NULL) return;
@@ -264,8 +268,9 @@ void brick_break_init(brick_break_ctx_t *ctx, uint32_t *main_tick, const Screen_
     reset_game(ctx);
 }
 
-// עϷ
+// 注册游戏组件
 const page_component_t BRICK_BREAK_COMP = {
     .draw = brick_break_draw,
-    .input = brick_break_input
+    .input = brick_break_input,
+    .multi_step = false
 };
\ No newline at end of file
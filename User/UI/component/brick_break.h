@@ -7,61 +7,62 @@
 #include "u8g2.h"
 #include <stdint.h>
 
-// ========== Ϸ ==========
-#define BRICK_ROWS 4                // ש
-#define BRICK_COLS 8                // ש
-#define BRICK_WIDTH 15              // ש
-#define BRICK_HEIGHT 6              // ש߶
-#define BRICK_GAP 2                 // ש
-#define PADDLE_WIDTH 20             // 
-#define PADDLE_HEIGHT 3             // ߶
-#define BALL_SIZE 2                 // Сߴ
-#define PADDLE_SPEED 2              // ƶٶȣ͸ײ
-#define BALL_SPEED_DIVISOR 3        // СٶȳֵԽԽ
-#define BALL_SPEED_X 1              // СXٶ
-#define BALL_SPEED_Y 1              // СYٶ
+// ========== 游戏配置项 ==========
+#define BRICK_ROWS 4                // 砖块行数
+#define BRICK_COLS 8                // 砖块列数
+#define BRICK_WIDTH 15              // 砖块宽度
+#define BRICK_HEIGHT 6              // 砖块高度
+#define BRICK_GAP 2                 // 砖块间距
+#define PADDLE_WIDTH 20             // 挡板宽度
+#define PADDLE_HEIGHT 3             // 挡板高度
+#define BALL_SIZE 2                 // 小球尺寸
+#define PADDLE_SPEED 2              // 挡板移动速度（调低更易操作）
+#define BALL_STEP_MS 30             // 小球每移动一步的间隔ms（值越大越慢）
+#define BALL_MAX_STEPS 3            // 每帧最多补走的步数，落后更多时（页面被遮挡或离开后）从当前时刻继续
+#define BALL_SPEED_X 1              // 小球X轴基础速度
+#define BALL_SPEED_Y 1              // 小球Y轴基础速度
 
-// Ϸ״̬ö
+// 游戏状态枚举
 typedef enum {
-    GAME_STATE_READY,       // ׼ʼ
-    GAME_STATE_PLAYING,     // Ϸ
-    GAME_STATE_GAME_OVER,   // Ϸ
-    GAME_STATE_VICTORY      // Ϸʤ
+    GAME_STATE_READY,       // 准备开始
+    GAME_STATE_PLAYING,     // 游戏中
+    GAME_STATE_GAME_OVER,   // 游戏结束
+    GAME_STATE_VICTORY      // 游戏胜利
 } game_state_t;
 
-// שṹ
+// 砖块结构体
 typedef struct {
-    uint8_t x;              // X
-    uint8_t y;              // Y
-    bool active;            // Ƿڣδ飩
+    uint8_t x;              // X坐标
+    uint8_t y;              // Y坐标
+    bool active;            // 是否存在（未被击碎）
 } brick_t;
 
-// ϷģtickֶΣ
+// 游戏上下文（增加tick字段）
 typedef struct {
-    // 
+    // 挡板属性
     uint8_t paddle_x;
     uint8_t paddle_y;
     
-    // С
+    // 小球属性
     uint8_t ball_x;
     uint8_t ball_y;
-    int8_t ball_dir_x;      // X-1() / 1()
-    int8_t ball_dir_y;      // Y-1() / 1()
-    uint32_t ball_tick;     // Сƶʱtick
+    int8_t ball_dir_x;      // X方向：-1(左) / 1(右)
+    int8_t ball_dir_y;      // Y方向：-1(上) / 1(下)
+    uint32_t ball_tick;     // 小球上一次移动的时间（ms）
     
-    // ש
+    // 砖块数组
     brick_t bricks[BRICK_ROWS][BRICK_COLS];
     
-    // Ϸ״̬
+    // 游戏状态
     game_state_t state;
-    uint32_t *main_tick;    // ȫtickָ
-    const Screen_t *screen; // Ļ
+    uint32_t *main_tick;    // 全局tick指针
+    const Screen_t *screen; // 屏幕配置
 } brick_break_ctx_t;
 
-// Ϸʵ
+// 游戏组件实例
 extern const page_component_t BRICK_BREAK_COMP;
 
-// ʼϷ
+// 初始化游戏上下文
 void brick_break_init(brick_break_ctx_t *ctx, uint32_t *main_tick, const Screen_t *screen);
 
 #endif // __BRICK_BREAK_H__
\ No newline at end of file
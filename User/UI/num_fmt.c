@@ -0,0 +1,89 @@
+#include "num_fmt.h"
+#include "fixmath.h"
+#include <string.h>
+
+// 输出 [符号][补齐][body], 返回写入的字符数
+static uint8_t num_fmt_out(char *buf, uint8_t size, char sign, char pad, uint8_t width,
+                           const char *body, uint8_t body_len) {
+  uint8_t len = 0;
+  uint8_t total = body_len + (sign ? 1 : 0);
+  if (size == 0) return 0;
+
+  // 空格补在符号之前, 0 补在符号之后, 与 printf 相同
+  if (pad == ' ')
+    while (total < width && len + 1 < size) buf[len++] = ' ', width--;
+  if (sign && len + 1 < size) buf[len++] = sign;
+  if (pad == '0')
+    while (total < width && len + 1 < size) buf[len++] = '0', width--;
+  while (body_len-- > 0 && len + 1 < size) buf[len++] = *body++;
+  buf[len] = '\0';
+  return len;
+}
+
+// q 的十进制数字写到 end 之前, 至少 min_digits 位, decimals > 0 时在倒数第 decimals 位前插入小数点
+static char *num_fmt_digits(char *end, uint64_t q, uint8_t min_digits, uint8_t decimals) {
+  uint8_t n = 0;
+  while (q > 0xffffffffUL || n < decimals) { // 大数先用 64 位除法, 降到 32 位后改用 32 位除法
+    *--end = (char)('0' + (uint32_t)(q % 10));
+    q /= 10;
+    if (++n == decimals) *--end = '.';
+    if (q == 0 && n >= min_digits) return end;
+  }
+  uint32_t v = (uint32_t)q;
+  do {
+    *--end = (char)('0' + v % 10);
+    v /= 10;
+    n++;
+  } while (v != 0 || n < min_digits);
+  return end;
+}
+
+uint8_t num_fmt_float(char *buf, uint8_t size, float val, uint8_t decimals, uint8_t width) {
+  uint32_t bits;
+  uint64_t q;
+  char tmp[24]; // 最多 10 位整数 + 小数点 + 9 位小数
+  char *end = tmp + sizeof(tmp);
+  char *p;
+
+  memcpy(&bits, &val, sizeof(bits));
+  char sign = (bits >> 31) ? '-' : 0; // -0.0 与舍入为 0 的负数同样带符号
+  int exp = (int)((bits >> 23) & 0xff);
+  uint32_t man = bits & 0x7fffff;
+  if (decimals > NUM_FMT_MAX_DECIMALS) decimals = NUM_FMT_MAX_DECIMALS;
+
+  if (exp == 0xff)
+    return num_fmt_out(buf, size, sign, ' ', width, man ? "nan" : "inf", 3);
+
+  // val = man * 2^exp, 整数尾数乘以 10^decimals 后右移, 按被移出的部分舍入
+  if (exp == 0) {
+    exp = -149; // 非规格化数
+  } else {
+    man |= 0x800000;
+    exp -= 150;
+  }
+  if (exp >= 0) {
+    if (exp > 8) return num_fmt_out(buf, size, sign, ' ', width, "ovf", 3);
+    q = ((uint64_t)man << exp) * fix_pow10(decimals);
+  } else {
+    uint64_t scaled = (uint64_t)man * fix_pow10(decimals); // < 2^54
+    int shift = -exp;
+    if (shift > 55) {
+      q = 0; // 被移出的部分小于 1/2
+    } else {
+      uint64_t half = 1ULL << (shift - 1);
+      uint64_t rem = scaled & ((half << 1) - 1);
+      q = scaled >> shift;
+      if (rem > half || (rem == half && (q & 1))) q++;
+    }
+  }
+
+  p = num_fmt_digits(end, q, decimals + 1, decimals);
+  return num_fmt_out(buf, size, sign, '0', width, p, (uint8_t)(end - p));
+}
+
+uint8_t num_fmt_uint(char *buf, uint8_t size, uint32_t val, uint8_t width) {
+  char tmp[10];
+  char *end = tmp + sizeof(tmp);
+  char *p = num_fmt_digits(end, val, 1, 0);
+  return num_fmt_out(buf, size, 0, '0', width, p, (uint8_t)(end - p));
+}
@@ -0,0 +1,27 @@
+#ifndef __NUM_FMT_H__
+#define __NUM_FMT_H__
+
+#include <stdint.h>
+
+// 数值格式化: 只用整数运算, 不依赖 printf 的浮点支持, 也不分配内存.
+// 输出与 snprintf 的 "%0*.*f" / "%0*u" 逐字节相同 (四舍六入五成双, 按浮点数的精确值舍入)
+
+#define NUM_FMT_MAX_DECIMALS 9 // 小数位数上限, 超出按此值处理
+
+/**
+ * @brief 按 "%0<width>.<decimals>f" 格式化浮点数
+ * @param buf 输出缓冲区, 总是以 '\0' 结尾 (size 为 0 时不写入)
+ * @param size 缓冲区大小, 不足时截断
+ * @param width 最小宽度 (含符号与小数点), 不足时在符号后补 0, 为 0 时不补
+ * @return 写入的字符数 (不含 '\0')
+ * @note  |val| >= 2^32 时输出 "ovf"; inf / nan 输出 "inf" / "nan" 并以空格补齐
+ */
+uint8_t num_fmt_float(char *buf, uint8_t size, float val, uint8_t decimals, uint8_t width);
+
+/**
+ * @brief 按 "%0<width>u" 格式化无符号整数
+ * @return 写入的字符数 (不含 '\0')
+ */
+uint8_t num_fmt_uint(char *buf, uint8_t size, uint32_t val, uint8_t width);
+
+#endif
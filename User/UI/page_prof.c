@@ -0,0 +1,159 @@
+#include "page_prof.h"
+
+#if PAGE_PROF_ENABLE
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+// 一项统计: 样本 (0.1us) 的对数直方图, 计数满时全部减半, 保持分布形状
+typedef struct {
+  uint16_t hist[PAGE_PROF_HIST_BUCKETS];
+  uint32_t count;
+  uint64_t sum;
+  uint32_t min;
+  uint32_t max;
+} page_prof_stat_t;
+
+typedef struct {
+  const void *comp;
+  const char *name;
+  page_prof_stat_t stat;
+} page_prof_comp_t;
+
+typedef struct {
+  page_prof_clock_cb_t clock_cb;
+  uint32_t ticks_per_us;
+  page_prof_stat_t phase[PAGE_PROF_PHASE_NUM];
+  page_prof_comp_t comp[PAGE_PROF_MAX_COMP];
+} page_prof_t;
+
+static page_prof_t g_page_prof;
+
+static const char *const page_prof_phase_name[PAGE_PROF_PHASE_NUM] = {
+    "input", "clear", "draw", "portal", "send", "frame"};
+
+// 样本所在的桶: 小于 2 时为样本值, 否则 [2^k, 1.5*2^k) 为 2k, [1.5*2^k, 2^(k+1)) 为 2k+1
+static uint8_t page_prof_bucket(uint32_t v) {
+  uint8_t k = 1, b;
+
+  if (v < 2) return (uint8_t)v;
+  while ((v >> (k + 1)) != 0) k++;
+  b = 2 * k + ((v >> (k - 1)) & 1);
+  return b < PAGE_PROF_HIST_BUCKETS ? b : PAGE_PROF_HIST_BUCKETS - 1;
+}
+
+// 桶中最大的样本值
+static uint32_t page_prof_bucket_upper(uint8_t b) {
+  uint8_t k = b / 2;
+
+  if (b < 2) return b;
+  return (b & 1) ? (2UL << k) - 1 : (1UL << k) + (1UL << (k - 1)) - 1;
+}
+
+static void page_prof_stat_add(page_prof_stat_t *s, uint32_t v) {
+  uint8_t b = page_prof_bucket(v);
+
+  if (s->hist[b] == UINT16_MAX) {
+    for (uint8_t i = 0; i < PAGE_PROF_HIST_BUCKETS; i++) s->hist[i] = (s->hist[i] + 1) / 2;
+  }
+  s->hist[b]++;
+  if (s->count == 0 || v < s->min) s->min = v;
+  if (v > s->max) s->max = v;
+  s->count++;
+  s->sum += v;
+}
+
+// 查找组件的统计项, 不存在时占用一个空位, 已满返回 NULL
+static page_prof_comp_t *page_prof_find_comp(const void *comp) {
+  for (uint8_t i = 0; i < PAGE_PROF_MAX_COMP; i++) {
+    if (g_page_prof.comp[i].comp == comp) return &g_page_prof.comp[i];
+    if (g_page_prof.comp[i].comp == NULL) {
+      g_page_prof.comp[i].comp = comp;
+      return &g_page_prof.comp[i];
+    }
+  }
+  return NULL;
+}
+
+// 计数值转换为 0.1us
+static uint32_t page_prof_to_100ns(uint32_t ticks) {
+  return (uint32_t)((uint64_t)ticks * 10 / g_page_prof.ticks_per_us);
+}
+
+static void page_prof_print_stat(page_prof_print_cb_t print, const char *name,
+                                 const void *comp, const page_prof_stat_t *s) {
+  unsigned long min, avg, max, p99;
+  uint32_t total = 0, rank, seen = 0;
+  uint8_t b;
+  char label[16];
+
+  if (s->count == 0) return;
+
+  // 直方图减半过, 按桶内计数之和求 99% 位置
+  for (b = 0; b < PAGE_PROF_HIST_BUCKETS; b++) total += s->hist[b];
+  rank = (total * 99 + 99) / 100;
+  for (b = 0; b < PAGE_PROF_HIST_BUCKETS - 1; b++) {
+    seen += s->hist[b];
+    if (seen >= rank) break;
+  }
+  min = s->min;
+  max = s->max;
+  avg = (unsigned long)(s->sum / s->count);
+  p99 = page_prof_bucket_upper(b);
+  if (p99 > max) p99 = max;
+
+  if (name)
+    snprintf(label, sizeof(label), "%s", name);
+  else
+    snprintf(label, sizeof(label), "%p", comp);
+  print("%-12s %6lu %7lu.%lu %7lu.%lu %7lu.%lu %7lu.%lu", label,
+        (unsigned long)s->count, min / 10, min % 10, avg / 10, avg % 10, max / 10,
+        max % 10, p99 / 10, p99 % 10);
+}
+
+void page_prof_init(page_prof_clock_cb_t clock_cb, uint32_t ticks_per_us) {
+  memset(&g_page_prof, 0, sizeof(g_page_prof));
+  g_page_prof.clock_cb = clock_cb;
+  g_page_prof.ticks_per_us = ticks_per_us ? ticks_per_us : 1;
+}
+
+uint32_t page_prof_now(void) {
+  return g_page_prof.clock_cb ? g_page_prof.clock_cb() : 0;
+}
+
+void page_prof_record(page_prof_phase_t phase, const void *comp, uint32_t start) {
+  uint32_t dt = page_prof_now() - start;
+  page_prof_comp_t *c;
+
+  dt = page_prof_to_100ns(dt);
+  page_prof_stat_add(&g_page_prof.phase[phase], dt);
+  if (comp != NULL && (c = page_prof_find_comp(comp)) != NULL)
+    page_prof_stat_add(&c->stat, dt);
+}
+
+void page_prof_set_name(const void *comp, const char *name) {
+  page_prof_comp_t *c = page_prof_find_comp(comp);
+  if (c != NULL) c->name = name;
+}
+
+void page_prof_dump(page_prof_print_cb_t print) {
+  if (print == NULL) return;
+
+  print("%-12s %6s %9s %9s %9s %9s (us)", "phase", "n", "min", "avg", "max",
+        "p99");
+  for (uint8_t i = 0; i < PAGE_PROF_PHASE_NUM; i++)
+    page_prof_print_stat(print, page_prof_phase_name[i], NULL, &g_page_prof.phase[i]);
+  for (uint8_t i = 0; i < PAGE_PROF_MAX_COMP; i++) {
+    const page_prof_comp_t *c = &g_page_prof.comp[i];
+    if (c->comp != NULL)
+      page_prof_print_stat(print, c->name, c->comp, &c->stat);
+  }
+}
+
+void page_prof_reset(void) {
+  memset(g_page_prof.phase, 0, sizeof(g_page_prof.phase));
+  for (uint8_t i = 0; i < PAGE_PROF_MAX_COMP; i++)
+    memset(&g_page_prof.comp[i].stat, 0, sizeof(g_page_prof.comp[i].stat));
+}
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef __PAGE_PROF_H__
+#define __PAGE_PROF_H__
+
+#include <stdint.h>
+
+// ========== 配置项 ==========
+// 帧分段计时开关, 为 0 时下面的宏全部展开为空
+#ifndef PAGE_PROF_ENABLE
+#define PAGE_PROF_ENABLE 0
+#endif
+// 每项统计为对数直方图: 每个 2 的幂区间分为两个桶 (分辨率约 25%), 单位 0.1us,
+// 最后一个桶收集约 1.6s 以上的样本. p99 取所在桶的上界 (不超过 max)
+#define PAGE_PROF_HIST_BUCKETS 48
+#define PAGE_PROF_MAX_COMP 8 // 分别统计的组件数
+
+// 计时阶段
+typedef enum {
+  PAGE_PROF_INPUT,  // 输入分发
+  PAGE_PROF_CLEAR,  // u8g2_ClearBuffer (portal 图层恢复 / 页面过渡合成)
+  PAGE_PROF_DRAW,   // 底层页面绘制
+  PAGE_PROF_PORTAL, // portal 绘制
+  PAGE_PROF_SEND,   // 发送到屏幕
+  PAGE_PROF_FRAME,  // 整帧
+  PAGE_PROF_PHASE_NUM
+} page_prof_phase_t;
+
+// 计数器回调 (目标板为 DWT 周期数, 主机为纳秒), 允许回绕
+typedef uint32_t (*page_prof_clock_cb_t)(void);
+// 输出回调, 每次输出一行
+typedef void (*page_prof_print_cb_t)(const char *fmt, ...);
+
+#if PAGE_PROF_ENABLE
+// ticks_per_us: 计数器每微秒的计数值
+void page_prof_init(page_prof_clock_cb_t clock_cb, uint32_t ticks_per_us);
+uint32_t page_prof_now(void);
+// 记录 start 至今的耗时, comp 非 NULL 时同时计入该组件
+void page_prof_record(page_prof_phase_t phase, const void *comp, uint32_t start);
+// 为组件命名, 输出时使用
+void page_prof_set_name(const void *comp, const char *name);
+// 输出各阶段与各组件自上次 reset 以来的 min/avg/max/p99 (us)
+void page_prof_dump(page_prof_print_cb_t print);
+void page_prof_reset(void);
+
+#define PAGE_PROF_BEGIN(t) uint32_t t = page_prof_now()
+#define PAGE_PROF_END(phase, t) page_prof_record((phase), NULL, (t))
+#define PAGE_PROF_END_COMP(phase, comp, t) page_prof_record((phase), (comp), (t))
+#else
+#define page_prof_init(clock_cb, ticks_per_us) ((void)0)
+#define page_prof_set_name(comp, name) ((void)0)
+#define page_prof_dump(print) ((void)0)
+#define page_prof_reset() ((void)0)
+
+#define PAGE_PROF_BEGIN(t) ((void)0)
+#define PAGE_PROF_END(phase, t) ((void)0)
+#define PAGE_PROF_END_COMP(phase, comp, t) ((void)0)
+#endif
+
+#endif
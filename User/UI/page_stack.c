@@ -1,28 +1,271 @@
 #include "page_stack.h"
-#include "screen.h"  // g_screen_cfg
+#include "page_prof.h"
+#include "screen.h"  // 导入g_screen_cfg
 
-// ȫҳջʵ
+// 全局页面栈实例
 page_stack_t g_page_stack;
 
-#define GET_ANI_STEP() (1.0f / (float)g_screen_cfg.animation_duration)
+#if PAGE_STACK_SEND_MODE == PAGE_SEND_DIFF
+// 上一次发送到屏幕的帧, 由 SSD1306 驱动维护
+static uint8_t page_shadow_buf[PAGE_SHADOW_BUF_SIZE];
+#endif
+
+// 按 PAGE_STACK_SEND_MODE 将缓冲区发送到屏幕
+static void page_send_frame(page_stack_t *ps) {
+#if PAGE_STACK_SEND_MODE == PAGE_SEND_DIRTY
+    u8g2_SendDirtyBuffer(ps->u8g2);
+#else
+    u8g2_SendBuffer(ps->u8g2);
+#endif
+}
+
+// Portal 顶层绘制, 位置由进入/退出动画进度决定
+static void page_draw_portal(page_stack_t *ps) {
+    u8g2_SetMaxClipWindow(ps->u8g2); // 防止被底层裁切污染
+#if UI_FIXED_MATH
+    q16_t eased = ps->is_exiting ? QuadraticEaseInQ16(ps->ani_progress) : QuadraticEaseOutQ16(ps->ani_progress);
+    int current_y = -ps->active_portal->h + fix_mul_int(eased, (g_screen_cfg.height - ps->active_portal->h)/2 + ps->active_portal->h);
+#else
+    float eased = ps->is_exiting ? QuadraticEaseIn(ps->ani_progress) : QuadraticEaseOut(ps->ani_progress);
+    int current_y = -ps->active_portal->h + (int)(( (g_screen_cfg.height - ps->active_portal->h)/2 + ps->active_portal->h ) * eased);
+#endif
+    // portal 自身的重绘请求 (如滚动标题) 单独记录, 不视为底层页面改变
+    bool need_redraw = ps->need_redraw;
+    ps->need_redraw = false;
+    PAGE_PROF_BEGIN(t_portal);
+    ps->active_portal->draw(ps->u8g2, (g_screen_cfg.width - ps->active_portal->w)/2, current_y, 
+                            ps->active_portal->w, ps->active_portal->h, ps->portal_ctx);
+    PAGE_PROF_END_COMP(PAGE_PROF_PORTAL, ps->active_portal, t_portal);
+    ps->portal_wants_frame = ps->need_redraw;
+    ps->need_redraw = need_redraw;
+}
+
+#if PAGE_STACK_PORTAL_LAYER || PAGE_STACK_TRANSITION
+// portal 打开时的底层页面 / 过渡中的旧页面, tile 顺序与 u8g2 全缓冲相同
+static uint8_t page_layer_buf[PAGE_SHADOW_BUF_SIZE];
+
+// 只有整屏缓冲才能保存为图层
+static bool page_layer_usable(u8g2_t *u8g2) {
+    uint8_t th = u8g2_GetBufferTileHeight(u8g2);
+    return th == u8g2_GetU8x8(u8g2)->display_info->tile_height &&
+           (uint16_t)u8g2_GetBufferTileWidth(u8g2) * th * 8 <= sizeof(page_layer_buf);
+}
+#endif
+
+#if PAGE_STACK_PORTAL_LAYER
+
+// 将上一帧 portal 绘制过的 tile 恢复为底层页面
+static void page_layer_restore(page_stack_t *ps) {
+    uint8_t *buf = u8g2_GetBufferPtr(ps->u8g2);
+    uint16_t tiles = (uint16_t)u8g2_GetBufferTileWidth(ps->u8g2) * u8g2_GetBufferTileHeight(ps->u8g2);
+    for (uint16_t idx = 0; idx < tiles; idx += 8) {
+        uint8_t bits = ps->layer_portal_tiles[idx >> 3];
+        for (uint8_t i = 0; bits; i++, bits >>= 1)
+            if (bits & 1) memcpy(buf + (idx + i) * 8, page_layer_buf + (idx + i) * 8, 8);
+    }
+}
+
+// 只发送 tiles 中的 tile, 每个 tile 行发送包含它们的一段
+static void page_layer_send(page_stack_t *ps, const uint8_t *tiles) {
+#if PAGE_STACK_SEND_MODE == PAGE_SEND_DIRTY
+    uint8_t tw = u8g2_GetBufferTileWidth(ps->u8g2);
+    uint8_t th = u8g2_GetBufferTileHeight(ps->u8g2);
+    for (uint8_t ty = 0; ty < th; ty++) {
+        int16_t tx0 = -1, tx1 = -1;
+        for (uint8_t tx = 0; tx < tw; tx++) {
+            uint16_t idx = (uint16_t)ty * tw + tx;
+            if (tiles[idx >> 3] & (1 << (idx & 7))) {
+                if (tx0 < 0) tx0 = tx;
+                tx1 = tx;
+            }
+        }
+        if (tx0 >= 0) u8g2_UpdateDisplayArea(ps->u8g2, tx0, ty, tx1 - tx0 + 1, 1);
+    }
+    // 与 SendDirtyBuffer 相同, 结束本帧 (stream 驱动在此关闭仍打开的数据传输)
+    u8x8_RefreshDisplay(u8g2_GetU8x8(ps->u8g2));
+#else
+    // 整帧发送; DIFF 模式本身只发送变化的列
+    (void)tiles;
+    page_send_frame(ps);
+#endif
+}
+
+// 合成一帧: 恢复上一帧 portal 覆盖的区域, 重绘 portal, 只发送这两部分
+static void page_layer_composite(page_stack_t *ps) {
+    uint8_t *dirty = ps->u8g2->tile_dirty;
+    uint8_t send_tiles[PAGE_LAYER_TILE_BYTES];
+
+    PAGE_PROF_BEGIN(t_clear);
+    page_layer_restore(ps);
+    memset(dirty, 0, PAGE_LAYER_TILE_BYTES);
+    PAGE_PROF_END(PAGE_PROF_CLEAR, t_clear);
+
+    page_draw_portal(ps);
+
+    // 脏 tile 仍包含底层页面, 使之后的 SendDirtyBuffer / SendBuffer 记录的屏幕内容正确
+    for (uint8_t i = 0; i < PAGE_LAYER_TILE_BYTES; i++) {
+        send_tiles[i] = ps->layer_portal_tiles[i] | dirty[i];
+        ps->layer_portal_tiles[i] = dirty[i];
+        dirty[i] |= ps->layer_base_tiles[i];
+    }
+
+    PAGE_PROF_BEGIN(t_send);
+    page_layer_send(ps, send_tiles);
+    PAGE_PROF_END(PAGE_PROF_SEND, t_send);
+}
+#endif
+
+#if PAGE_STACK_TRANSITION
+// 过渡中的新页面
+static uint8_t page_trans_buf[PAGE_SHADOW_BUF_SIZE];
+
+// 4x4 Bayer 抖动阈值 [y & 3][x & 3]
+static const uint8_t page_trans_bayer[4][4] = {
+    {0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}};
+
+// 以屏幕上的内容 (上一帧) 作为旧页面开始过渡, 新页面在下一帧绘制
+static void page_trans_start(page_stack_t *ps, uint8_t trans, bool reverse) {
+    ps->trans = PAGE_TRANS_NONE;
+    // portal 与过渡共用快照缓冲, portal 打开时直接切换
+    if (trans == PAGE_TRANS_NONE || ps->is_portal_running || !page_layer_usable(ps->u8g2)) return;
+    memcpy(page_layer_buf, u8g2_GetBufferPtr(ps->u8g2), sizeof(page_layer_buf));
+#if PAGE_STACK_PORTAL_LAYER
+    ps->layer_valid = false;
+#endif
+    ps->trans = trans;
+    ps->trans_reverse = reverse;
+    ps->trans_ready = false;
+    ps->trans_tick = ps->main_tick;
+}
+
+// 按进度 amount (0 ~ 256) 将旧页面 (page_layer_buf) 与新页面 (page_trans_buf) 合成到缓冲区
+static void page_trans_compose(page_stack_t *ps, uint16_t amount) {
+    uint8_t *dst = u8g2_GetBufferPtr(ps->u8g2);
+    const uint8_t *from = page_layer_buf, *to = page_trans_buf;
+    uint16_t w = u8g2_GetBufferTileWidth(ps->u8g2) * 8;
+    uint8_t th = u8g2_GetBufferTileHeight(ps->u8g2);
+    uint16_t off = (uint16_t)(((uint32_t)amount * w) >> 8);
+    uint8_t mask[4] = {0};
+
+    if (ps->trans == PAGE_TRANS_FADE) {
+        // 阈值小于 level 的像素取新页面; 每字节的 8 个像素纵向排列, 掩码只与 x & 3 有关
+        uint8_t level = (uint8_t)((amount * 16) >> 8);
+        for (uint8_t c = 0; c < 4; c++)
+            for (uint8_t j = 0; j < 8; j++)
+                if (page_trans_bayer[j & 3][c] < level) mask[c] |= (uint8_t)(1 << j);
+    }
+
+    for (uint8_t ty = 0; ty < th; ty++, dst += w, from += w, to += w) {
+        switch (ps->trans) {
+        case PAGE_TRANS_SLIDE:
+            if (!ps->trans_reverse) {
+                memcpy(dst, from + off, w - off);
+                memcpy(dst + w - off, to, off);
+            } else {
+                memcpy(dst, to + w - off, off);
+                memcpy(dst + off, from, w - off);
+            }
+            break;
+        case PAGE_TRANS_COVER:
+            if (!ps->trans_reverse) {
+                memcpy(dst, from, w - off);
+                memcpy(dst + w - off, to, off);
+            } else { // 旧页面向右移出, 露出新页面
+                memcpy(dst, to, off);
+                memcpy(dst + off, from, w - off);
+            }
+            break;
+        default:
+            for (uint16_t x = 0; x < w; x++) {
+                uint8_t m = mask[x & 3];
+                dst[x] = (uint8_t)((to[x] & m) | (from[x] & ~m));
+            }
+            break;
+        }
+    }
+}
+
+// 过渡帧: 第一帧绘制新页面并保存快照, 之后只合成. 过渡结束时返回 false, 本帧照常绘制新页面
+static bool page_trans_frame(page_stack_t *ps) {
+    if (!ps->trans_ready) {
+        page_t *p_curr = page_stack_current(ps);
+        u8g2_ClearBuffer(ps->u8g2);
+        if (p_curr && p_curr->comp && p_curr->comp->draw) {
+            u8g2_SetMaxClipWindow(ps->u8g2);
+            u8g2_SetDrawColor(ps->u8g2, 1);
+            PAGE_PROF_BEGIN(t_draw);
+            p_curr->comp->draw(ps->u8g2, p_curr->ctx);
+            PAGE_PROF_END_COMP(PAGE_PROF_DRAW, p_curr->comp, t_draw);
+        }
+        memcpy(page_trans_buf, u8g2_GetBufferPtr(ps->u8g2), sizeof(page_trans_buf));
+        ps->trans_ready = true;
+    }
+
+    uint16_t amount;
+#if UI_FIXED_MATH
+    q16_t t = fix_progress(ps->main_tick - ps->trans_tick, g_screen_cfg.animation_duration);
+    if (t >= Q16_ONE) {
+        ps->trans = PAGE_TRANS_NONE;
+        return false;
+    }
+    amount = (uint16_t)fix_mul_int(QuadraticEaseInOutQ16(t), 256);
+#else
+    float t = (float)(ps->main_tick - ps->trans_tick) / g_screen_cfg.animation_duration;
+    if (t >= 1.0f) {
+        ps->trans = PAGE_TRANS_NONE;
+        return false;
+    }
+    amount = (uint16_t)(QuadraticEaseInOut(t) * 256);
+#endif
+
+    PAGE_PROF_BEGIN(t_clear);
+    page_trans_compose(ps, amount);
+    u8g2_MarkAllDirty(ps->u8g2);
+    PAGE_PROF_END(PAGE_PROF_CLEAR, t_clear);
+
+    PAGE_PROF_BEGIN(t_send);
+    page_send_frame(ps);
+    PAGE_PROF_END(PAGE_PROF_SEND, t_send);
+    return true;
+}
+#endif
 
 void page_stack_init(page_stack_t *ps, u8g2_t *u8g2) {
     memset(ps, 0, sizeof(page_stack_t));
     ps->u8g2 = u8g2;
     ps->global_btn_handler = NULL;
+    ps->need_redraw = true;
+#if PAGE_STACK_SEND_MODE == PAGE_SEND_DIFF
+    // 会清屏, 使影子缓冲与显存一致
+    u8g2_SetShadowBuffer(u8g2, page_shadow_buf);
+#endif
 }
 
 int page_stack_push(page_stack_t *ps, const page_component_t *comp, void *ctx) {
+    return page_stack_push_trans(ps, comp, ctx, PAGE_STACK_DEFAULT_TRANS);
+}
+
+int page_stack_push_trans(page_stack_t *ps, const page_component_t *comp, void *ctx,
+                          page_trans_t trans) {
     if (ps->top >= PAGE_STACK_MAX_DEPTH || comp == NULL) return -1;
     ps->stack[ps->top].comp = comp;
     ps->stack[ps->top].ctx = ctx;
+    ps->stack[ps->top].trans = (uint8_t)trans;
     ps->top++;
+    ps->need_redraw = true;
+#if PAGE_STACK_TRANSITION
+    page_trans_start(ps, trans, false);
+#endif
     return 0;
 }
 
 int page_stack_pop(page_stack_t *ps) {
     if (ps->top > 1) { 
         ps->top--; 
+        ps->need_redraw = true;
+#if PAGE_STACK_TRANSITION
+        page_trans_start(ps, ps->stack[ps->top].trans, true);
+#endif
         return 0; 
     }
     return -1;
@@ -32,83 +275,265 @@ page_t* page_stack_current(page_stack_t *ps) {
     return (ps->top > 0) ? &ps->stack[ps->top - 1] : NULL;
 }
 
-// עȫְص
+// 注册全局按键回调
 void page_stack_register_global_btn_cb(page_stack_t *ps, global_btn_cb_t cb) {
     if (ps != NULL) {
         ps->global_btn_handler = cb;
     }
 }
 
+// 注册屏幕忙查询
+void page_stack_register_busy_cb(page_stack_t *ps, display_busy_cb_t cb) {
+    if (ps != NULL) {
+        ps->display_busy_cb = cb;
+    }
+}
+
+// 注册毫秒时钟
+void page_stack_register_clock_cb(page_stack_t *ps, page_clock_cb_t cb) {
+    if (ps != NULL) {
+        ps->clock_cb = cb;
+        if (cb) {
+            ps->main_tick = cb();
+            ps->last_frame_tick = ps->main_tick - PAGE_FRAME_MS;
+        }
+    }
+}
+
+void page_stack_request_frame(page_stack_t *ps) {
+    if (ps != NULL) {
+        ps->need_redraw = true;
+    }
+}
+
 void page_stack_portal_toggle(page_stack_t *ps, const portal_component_t *comp, void *ctx, size_t ctx_size) {
     if (!ps) return;
 
     if (ps->is_portal_running) {
-        // У˳
+        // 如果正在运行，启动退出动画
         ps->is_exiting = true;
     } else {
-        // 붯
+        // 启动进入动画
         if (comp && ctx) {
             ps->active_portal = comp;
             
-            // ṹݴ buffer
+            // 将匿名结构体内容存入 buffer
             if (ctx_size > PORTAL_CTX_BUFFER_SIZE) ctx_size = PORTAL_CTX_BUFFER_SIZE;
             memcpy(ps->portal_ctx_buffer, ctx, ctx_size);
             ps->portal_ctx = ps->portal_ctx_buffer;
             
             ps->is_portal_running = true;
             ps->is_exiting = false;
-            ps->ani_progress = 0.0f;
+            ps->ani_progress = 0;
+#if PAGE_STACK_TRANSITION
+            ps->trans = PAGE_TRANS_NONE; // 快照缓冲交给 portal 图层
+#endif
         }
     }
+    ps->ani_tick = ps->main_tick;
+    ps->need_redraw = true;
 }
 
-void page_update(page_stack_t *ps, btn_type_t btn) {
-    if (!ps) return;
-	ps->main_tick++;
-    // ַ
-    if (btn != BTN_NONE) {
-        if (ps->global_btn_handler) ps->global_btn_handler(btn);
-        
-        if (ps->is_portal_running && !ps->is_exiting) {
-            if (ps->active_portal && ps->active_portal->input)
-                ps->active_portal->input(btn, ps->portal_ctx);
-            btn = BTN_NONE; // 
+// 输入交给 portal (拦截) 或栈顶页面. 不支持多步输入的组件按步数逐次调用,
+// 途中页面切换或 portal 打开/关闭时丢弃剩余的步数
+static void page_dispatch_input(page_stack_t *ps, int btn) {
+    btn_type_t type = btn_get_type(btn);
+    uint8_t steps = btn_get_steps(btn);
+
+    if (ps->is_portal_running && !ps->is_exiting) {
+        const portal_component_t *portal = ps->active_portal;
+        if (!portal || !portal->input) return;
+        if (portal->multi_step) {
+            portal->input(btn, ps->portal_ctx);
+            return;
+        }
+        do {
+            portal->input(type, ps->portal_ctx);
+        } while (--steps && ps->is_portal_running && !ps->is_exiting && ps->active_portal == portal);
+    } else {
+        page_t *p = page_stack_current(ps);
+        if (!p || !p->comp || !p->comp->input) return;
+        const page_component_t *comp = p->comp;
+        void *ctx = p->ctx;
+        if (comp->multi_step) {
+            comp->input(btn, ctx);
+            return;
+        }
+        do {
+            comp->input(type, ctx);
+        } while (--steps && !ps->is_portal_running && page_stack_current(ps) == p && p->comp == comp &&
+                 p->ctx == ctx);
+    }
+}
+
+static void page_handle_input(page_stack_t *ps, int btn) {
+    PAGE_PROF_BEGIN(t_input);
+#if PAGE_STACK_TRANSITION
+    ps->trans = PAGE_TRANS_NONE; // 过渡中收到输入: 直接显示新页面
+#endif
+    if (ps->global_btn_handler) ps->global_btn_handler(btn_get_type(btn));
+    page_dispatch_input(ps, btn);
+    ps->need_redraw = true;
+    PAGE_PROF_END(PAGE_PROF_INPUT, t_input);
+}
+
+#if PAGE_STACK_INPUT_DRAIN
+// 同一方向键的连续输入可以合并, 步数不超过 btn_event_t.steps 的范围
+static bool page_input_mergeable(int a, int b) {
+    btn_type_t type = btn_get_type(a);
+    if (type != btn_get_type(b)) return false;
+    if (type != BTN_UP && type != BTN_DOWN && type != BTN_LEFT && type != BTN_RIGHT) return false;
+    return btn_get_steps(a) + btn_get_steps(b) <= 255;
+}
+#endif
+
+bool page_update(page_stack_t *ps, int btn) {
+    if (!ps) return false;
+    // 先更新时间, 使输入处理记录的动画起点为当前时刻
+    if (ps->clock_cb) ps->main_tick = ps->clock_cb();
+
+    // 输入拦截与分发
+#if PAGE_STACK_INPUT_DRAIN
+    // 取出队列中的全部事件, 连续的同向方向键合并为一个多步输入
+    for (uint8_t n = 0; n < PAGE_INPUT_DRAIN_MAX; n++) {
+        int next = btn_fifo_pop_input();
+        if (next == BTN_NONE) break;
+        if (btn == BTN_NONE) {
+            btn = next;
+        } else if (page_input_mergeable(btn, next)) {
+            btn = btn_pack_steps(btn_get_type(btn), btn_get_steps(btn) + btn_get_steps(next));
         } else {
-            page_t *p = page_stack_current(ps);
-            if (p && p->comp && p->comp->input) p->comp->input(btn, p->ctx);
+            page_handle_input(ps, btn);
+            btn = next;
         }
     }
+#endif
+    if (btn != BTN_NONE) page_handle_input(ps, btn);
 
-    //  (Portal)
+    // 上一帧仍在传输: 本次不重绘
+    if (ps->display_busy_cb && ps->display_busy_cb()) return false;
+
+    // 按目标帧率调度
+    if (ps->clock_cb) {
+        uint32_t elapsed = ps->main_tick - ps->last_frame_tick;
+        if (elapsed < PAGE_FRAME_MS) return false;
+#if PAGE_STACK_INPUT_DRAIN
+        // 还有未处理的输入 (超过单次取出的上限, 或处理期间写入): 先处理完再绘制, 最多推迟 PAGE_INPUT_DEFER_MS
+        if (!btn_fifo_is_empty() && elapsed < PAGE_FRAME_MS + PAGE_INPUT_DEFER_MS) return false;
+#endif
+        // 落后超过一帧时不追赶, 从当前时刻重新对齐
+        ps->last_frame_tick = (elapsed < 2 * PAGE_FRAME_MS) ? ps->last_frame_tick + PAGE_FRAME_MS
+                                                            : ps->main_tick;
+    } else {
+        ps->main_tick += PAGE_FRAME_MS;
+    }
+
+#if PAGE_STACK_IDLE_SKIP
+    // 没有动画也没有输入: 屏幕内容不变, 不绘制也不发送
+#if UI_FIXED_MATH
+    bool portal_animating = ps->is_portal_running && (ps->is_exiting || ps->ani_progress < Q16_ONE);
+#else
+    bool portal_animating = ps->is_portal_running && (ps->is_exiting || ps->ani_progress < 1.0f);
+#endif
+#if PAGE_STACK_TRANSITION
+    portal_animating = portal_animating || ps->trans != PAGE_TRANS_NONE; // 页面过渡同样需要逐帧绘制
+#endif
+    portal_animating = portal_animating || (ps->is_portal_running && ps->portal_wants_frame);
+    if (!ps->need_redraw && !portal_animating) {
+        ps->skipped_frames++;
+        return false;
+    }
+#endif
+    // 上一帧之后有输入或重绘请求: 底层页面可能已改变
+    bool base_changed = ps->need_redraw;
+    ps->need_redraw = false;
+    PAGE_PROF_BEGIN(t_frame);
+
+    // 动画步进 (Portal)
     if (ps->is_portal_running) {
-        float step = 1.0f / g_screen_cfg.animation_duration;
+#if UI_FIXED_MATH
+        q16_t step = fix_progress(ps->main_tick - ps->ani_tick, g_screen_cfg.animation_duration);
+        ps->ani_tick = ps->main_tick;
+        ps->ani_progress += ps->is_exiting ? -step : step;
+        if (ps->ani_progress >= Q16_ONE) ps->ani_progress = Q16_ONE;
+#else
+        float step = (float)(ps->main_tick - ps->ani_tick) / g_screen_cfg.animation_duration;
+        ps->ani_tick = ps->main_tick;
         ps->ani_progress += ps->is_exiting ? -step : step;
         if (ps->ani_progress >= 1.0f) ps->ani_progress = 1.0f;
-        if (ps->ani_progress <= 0.0f) {
+#endif
+        // 进入动画的第一帧步长可能为 0, 只在退出时结束
+        if (ps->is_exiting && ps->ani_progress <= 0) {
             ps->is_portal_running = false;
             ps->active_portal = NULL;
         }
     }
 
+#if PAGE_STACK_TRANSITION
+    if (ps->trans != PAGE_TRANS_NONE && page_trans_frame(ps)) {
+        PAGE_PROF_END(PAGE_PROF_FRAME, t_frame);
+        return true;
+    }
+#endif
+
+#if PAGE_STACK_PORTAL_LAYER
+    // 底层页面未变化: 只恢复并重绘 portal 区域
+    if (ps->is_portal_running && ps->active_portal && ps->layer_valid && !base_changed) {
+        page_layer_composite(ps);
+        ps->layer_frames++;
+        PAGE_PROF_END(PAGE_PROF_FRAME, t_frame);
+        return true;
+    }
+#else
+    (void)base_changed;
+#endif
+
+    PAGE_PROF_BEGIN(t_clear);
     u8g2_ClearBuffer(ps->u8g2);
+    PAGE_PROF_END(PAGE_PROF_CLEAR, t_clear);
 
-    // 1. ײҳ
+    // 1. 底层页面绘制
     page_t *p_curr = page_stack_current(ps);
     if (p_curr && p_curr->comp && p_curr->comp->draw) {
-        // ؼȷײҳǰ״̬ɾ
+        // 关键：确保底层页面绘制前状态干净
         u8g2_SetMaxClipWindow(ps->u8g2);
         u8g2_SetDrawColor(ps->u8g2, 1);
+        PAGE_PROF_BEGIN(t_draw);
         p_curr->comp->draw(ps->u8g2, p_curr->ctx);
+        PAGE_PROF_END_COMP(PAGE_PROF_DRAW, p_curr->comp, t_draw);
     }
 
-    // 2. Portal 
+    // 2. Portal 顶层绘制
     if (ps->is_portal_running && ps->active_portal) {
-        u8g2_SetMaxClipWindow(ps->u8g2); // ֹײȾ
-        float eased = ps->is_exiting ? QuadraticEaseIn(ps->ani_progress) : QuadraticEaseOut(ps->ani_progress);
-        int current_y = -ps->active_portal->h + (int)(( (g_screen_cfg.height - ps->active_portal->h)/2 + ps->active_portal->h ) * eased);
-        ps->active_portal->draw(ps->u8g2, (g_screen_cfg.width - ps->active_portal->w)/2, current_y, 
-                                ps->active_portal->w, ps->active_portal->h, ps->portal_ctx);
+#if PAGE_STACK_PORTAL_LAYER
+        // 保存为图层, 分开记录底层与 portal 的脏 tile. portal 打开期间底层页面的动画暂停,
+        // 绘制时的重绘请求不计入, 之后的输入或外部请求才会重新绘制底层页面
+        ps->layer_valid = page_layer_usable(ps->u8g2);
+        if (ps->layer_valid) {
+            ps->need_redraw = false;
+            memcpy(page_layer_buf, u8g2_GetBufferPtr(ps->u8g2), sizeof(page_layer_buf));
+            memcpy(ps->layer_base_tiles, ps->u8g2->tile_dirty, PAGE_LAYER_TILE_BYTES);
+            memset(ps->u8g2->tile_dirty, 0, PAGE_LAYER_TILE_BYTES);
+        }
+#endif
+        page_draw_portal(ps);
+#if PAGE_STACK_PORTAL_LAYER
+        if (ps->layer_valid) {
+            memcpy(ps->layer_portal_tiles, ps->u8g2->tile_dirty, PAGE_LAYER_TILE_BYTES);
+            for (uint8_t i = 0; i < PAGE_LAYER_TILE_BYTES; i++)
+                ps->u8g2->tile_dirty[i] |= ps->layer_base_tiles[i];
+        }
+#endif
     }
+#if PAGE_STACK_PORTAL_LAYER
+    else {
+        ps->layer_valid = false;
+    }
+#endif
 
-    u8g2_SendBuffer(ps->u8g2);
+    PAGE_PROF_BEGIN(t_send);
+    page_send_frame(ps);
+    PAGE_PROF_END(PAGE_PROF_SEND, t_send);
+    PAGE_PROF_END(PAGE_PROF_FRAME, t_frame);
+    return true;
 }
\ No newline at end of file
@@ -3,68 +3,178 @@
 
 #include "btn_fifo.h"
 #include "easing.h"
+#include "easing_q16.h"
+#include "screen.h"
 #include "u8g2.h"
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 
-// ҳ溯
+// 页面函数类型
 typedef void (*page_draw_func_t)(u8g2_t *u8g2, void *ctx);
 typedef void (*page_input_func_t)(int btn, void *ctx);
-// ȫְص
+// 全局按键回调类型
 typedef void (*global_btn_cb_t)(btn_type_t btn);
+// 屏幕忙回调类型 (上一帧仍在传输)
+typedef bool (*display_busy_cb_t)(void);
+// 毫秒时钟回调类型
+typedef uint32_t (*page_clock_cb_t)(void);
 typedef void (*portal_draw_cb_t)(u8g2_t *u8g2, int16_t x, int16_t y, uint8_t w,
                                  uint8_t h, void *ctx);
 
-// ҳṹ
+// 页面组件结构体
 typedef struct {
   page_draw_func_t draw;
   page_input_func_t input;
+  bool multi_step; // input 能处理多步输入 (btn_get_steps), 否则按步数逐次调用
 } page_component_t;
 
-// Portal ṹ
+// Portal 组件结构体
 typedef struct {
   portal_draw_cb_t draw;
   page_input_func_t input;
   uint8_t w;
   uint8_t h;
+  bool multi_step; // 同 page_component_t
 } portal_component_t;
 
-// ҳڵṹ
+// 页面过渡效果 (push 时的方向, pop 时反向播放)
+typedef enum {
+  PAGE_TRANS_NONE = 0, // 立即切换
+  PAGE_TRANS_SLIDE,    // 新页面从右侧推入, 旧页面向左移出
+  PAGE_TRANS_COVER,    // 新页面从右侧滑入并覆盖旧页面
+  PAGE_TRANS_FADE,     // 有序抖动 (4x4 Bayer) 逐渐替换为新页面
+} page_trans_t;
+
+// 页面节点结构体
 typedef struct {
   const page_component_t *comp;
   void *ctx;
+  uint8_t trans; // 进入该页面时的过渡效果, 返回时反向播放
 } page_t;
 
 #define PAGE_STACK_MAX_DEPTH 8
 #define PORTAL_CTX_BUFFER_SIZE 64
 
-// ҳջĽṹ
+// 帧缓冲发送模式
+#define PAGE_SEND_FULL 0  // 每帧发送整个缓冲区 (1024字节)
+#define PAGE_SEND_DIRTY 1 // 仅发送本帧与上一帧绘制过的 tile
+#define PAGE_SEND_DIFF 2  // 与上一帧影子缓冲逐列比较, 仅发送变化的列
+#ifndef PAGE_STACK_SEND_MODE
+#define PAGE_STACK_SEND_MODE PAGE_SEND_DIRTY
+#endif
+#define PAGE_SHADOW_BUF_SIZE (128 * 64 / 8) // DIFF 模式影子缓冲大小
+
+// 帧调度
+#ifndef PAGE_STACK_TARGET_FPS
+#define PAGE_STACK_TARGET_FPS 50 // 目标帧率
+#endif
+#define PAGE_FRAME_MS (1000 / PAGE_STACK_TARGET_FPS)
+#ifndef PAGE_STACK_IDLE_SKIP
+#define PAGE_STACK_IDLE_SKIP 1 // 无动画且无输入时跳过绘制与发送
+#endif
+
+// 输入合并: page_update 在绘制前取出 btn_fifo 中的全部事件, 连续的同向方向键合并为一个
+// 多步输入 (一次跳转, 一次动画). 之后队列中仍有事件时推迟绘制, 最多推迟 PAGE_INPUT_DEFER_MS
+#ifndef PAGE_STACK_INPUT_DRAIN
+#define PAGE_STACK_INPUT_DRAIN 1
+#endif
+#ifndef PAGE_INPUT_DEFER_MS
+#define PAGE_INPUT_DEFER_MS PAGE_FRAME_MS
+#endif
+#define PAGE_INPUT_DRAIN_MAX (BTN_FIFO_SIZE * BTN_FIFO_LANES) // 每次最多取出的事件数
+
+// portal 图层合成: portal 打开时保存底层页面 (1KB 图层缓冲), 之后的帧只恢复并重绘
+// portal 覆盖的 tile, 底层页面的动画暂停. 有输入或重绘请求时照常整帧重绘一次.
+// 需要 u8g2 的脏 tile 标记: 未指定时随 U8G2_WITH_DIRTY_TILES 开启,
+// 以 U8G2_WITHOUT_DIRTY_TILES 编译时指定为 1 会报错
+#ifndef PAGE_STACK_PORTAL_LAYER
+#ifdef U8G2_WITH_DIRTY_TILES
+#define PAGE_STACK_PORTAL_LAYER 1
+#else
+#define PAGE_STACK_PORTAL_LAYER 0
+#endif
+#elif PAGE_STACK_PORTAL_LAYER && !defined(U8G2_WITH_DIRTY_TILES)
+#error "PAGE_STACK_PORTAL_LAYER requires U8G2_WITH_DIRTY_TILES (remove U8G2_WITHOUT_DIRTY_TILES)"
+#endif
+
+// 页面过渡: push/pop 时保存旧页面与新页面的快照 (各 1KB, 旧页面快照与 portal 图层共用),
+// 过渡期间每帧只由两个快照拷贝合成, 不调用页面的 draw. 时长为 animation_duration.
+// 默认关闭 (不占用快照缓冲), 此时 page_stack_push_trans 立即切换; 指定了
+// PAGE_STACK_DEFAULT_TRANS 时默认开启
+#ifndef PAGE_STACK_TRANSITION
+#ifdef PAGE_STACK_DEFAULT_TRANS
+#define PAGE_STACK_TRANSITION 1
+#else
+#define PAGE_STACK_TRANSITION 0
+#endif
+#endif
+#ifndef PAGE_STACK_DEFAULT_TRANS
+#define PAGE_STACK_DEFAULT_TRANS PAGE_TRANS_NONE // page_stack_push 使用的过渡效果
+#endif
+#define PAGE_LAYER_TILE_BYTES ((U8G2_DIRTY_MAX_TILES + 7) / 8)
+
+// 页面栈核心结构体
 typedef struct {
   page_t stack[PAGE_STACK_MAX_DEPTH];
   uint8_t top;
   u8g2_t *u8g2;
-  uint32_t main_tick;
-  global_btn_cb_t global_btn_handler; // ȫְص
-  // portal 
+  uint32_t main_tick; // 动画时间基准 (ms)
+  global_btn_cb_t global_btn_handler; // 全局按键回调
+  display_busy_cb_t display_busy_cb;  // 屏幕忙查询
+  page_clock_cb_t clock_cb;           // 毫秒时钟
+  // 帧调度
+  uint32_t last_frame_tick; // 上一帧的时间
+  bool need_redraw;         // 下一帧需要重绘
+  bool portal_wants_frame;  // portal 绘制时请求了下一帧 (动画中), 底层页面不必重绘
+  uint32_t skipped_frames;  // 因空闲跳过的帧数
+  // portal 相关
   const portal_component_t *active_portal;
   uint8_t portal_ctx_buffer[PORTAL_CTX_BUFFER_SIZE];
   void *portal_ctx;
   bool is_portal_running;
   bool is_exiting;
+#if UI_FIXED_MATH
+  q16_t ani_progress; // portal 动画进度 [0, Q16_ONE]
+#else
   float ani_progress;
+#endif
+  uint32_t ani_tick; // 上一次推进 portal 动画的时间
+#if PAGE_STACK_PORTAL_LAYER
+  bool layer_valid;                                // 图层中的底层页面可用于合成
+  uint8_t layer_base_tiles[PAGE_LAYER_TILE_BYTES]; // 底层页面绘制过的 tile
+  uint8_t layer_portal_tiles[PAGE_LAYER_TILE_BYTES]; // 上一帧 portal 绘制过的 tile
+  uint32_t layer_frames;                           // 由图层合成的帧数
+#endif
+#if PAGE_STACK_TRANSITION
+  uint8_t trans;       // 正在播放的过渡效果, PAGE_TRANS_NONE 表示没有
+  bool trans_reverse;  // pop 时反向播放
+  bool trans_ready;    // 新页面已绘制为快照
+  uint32_t trans_tick; // 过渡开始的时间
+#endif
 } page_stack_t;
 
-extern page_stack_t g_page_stack; // ȫҳջʵ
+extern page_stack_t g_page_stack; // 全局页面栈实例
 
-// Ľӿ
+// 核心接口
 void page_stack_init(page_stack_t *ps, u8g2_t *u8g2);
 int page_stack_push(page_stack_t *ps, const page_component_t *comp, void *ctx);
+// 以指定的过渡效果进入页面, 返回该页面时反向播放同一效果
+int page_stack_push_trans(page_stack_t *ps, const page_component_t *comp, void *ctx,
+                          page_trans_t trans);
 int page_stack_pop(page_stack_t *ps);
 page_t *page_stack_current(page_stack_t *ps);
-void page_update(page_stack_t *ps, btn_type_t btn);
-// עȫְص
+// btn 可以是 btn_pack_steps 打包的多步输入, PAGE_STACK_INPUT_DRAIN 时随后取出 btn_fifo 中的全部事件;
+// 返回 true 表示本次绘制并发送了一帧, false 表示跳过
+bool page_update(page_stack_t *ps, int btn);
+// 注册全局按键回调
 void page_stack_register_global_btn_cb(page_stack_t *ps, global_btn_cb_t cb);
+// 注册屏幕忙查询, 忙时 page_update 只处理输入, 不推进动画也不重绘
+void page_stack_register_busy_cb(page_stack_t *ps, display_busy_cb_t cb);
+// 注册毫秒时钟, 未注册时每渲染一帧 main_tick 前进 PAGE_FRAME_MS
+void page_stack_register_clock_cb(page_stack_t *ps, page_clock_cb_t cb);
+// 请求重绘下一帧, 动画未结束的组件在 draw 中调用
+void page_stack_request_frame(page_stack_t *ps);
 void page_stack_portal_toggle(page_stack_t *ps, const portal_component_t *comp,
                               void *ctx, size_t ctx_size);
 
@@ -1,15 +1,16 @@
 #include "portal_component.h"
+#include "num_fmt.h"
 #include <math.h>
 #include <stdio.h>
 
-// --- MessageBox Portal  ---
+// --- MessageBox Portal 组件 ---
 static void portal_messagebox_draw(u8g2_t *u8g2, int16_t x, int16_t y,
                                    uint8_t w, uint8_t h, void *ctx) {
   if (!ctx)
     return;
   portal_ctx_message_box_t *data = (portal_ctx_message_box_t *)ctx;
 
-  // Ʊ
+  // 绘制背景和外框
   u8g2_SetDrawColor(u8g2, 0);
   u8g2_DrawBox(u8g2, x, y, w, h);
   u8g2_SetDrawColor(u8g2, 1);
@@ -17,15 +18,15 @@ static void portal_messagebox_draw(u8g2_t *u8g2, int16_t x, int16_t y,
 
   u8g2_SetFont(u8g2, g_screen_cfg.sub_window_font);
 
-  // л
+  // 标题居中绘制
   if (data->title) {
-    int title_w = u8g2_GetStrWidth(u8g2, data->title);
+    int title_w = str_width_get(u8g2, data->title);
     g_screen_cfg.draw_text(u8g2, x + (w - title_w) / 2, y + 12, data->title);
   }
 
   u8g2_DrawHLine(u8g2, x + 5, y + 15, w - 10);
 
-  // ݻ
+  // 内容绘制
   if (data->msg) {
     g_screen_cfg.draw_text(u8g2, x + 5, y + 27, data->msg);
   }
@@ -41,9 +42,23 @@ const portal_component_t PORTAL_MESSAGE_BOX = {.draw = portal_messagebox_draw,
                                                .input =
                                                    portal_message_box_input,
                                                .w = 100,
-                                               .h = 35};
+                                               .h = 35,
+                                               .multi_step = false};
+
+// 输出 "[a,b,...]", 数值保留 decimals 位小数并以 sep 分隔
+static void portal_fmt_range(char *buf, uint8_t size, const float *vals, uint8_t n, char sep,
+                             uint8_t decimals) {
+  uint8_t len = 0;
+  buf[len++] = '[';
+  for (uint8_t i = 0; i < n && len + 2 < size; i++) {
+    if (i > 0) buf[len++] = sep;
+    len += num_fmt_float(buf + len, size - len - 1, vals[i], decimals, 0);
+  }
+  buf[len++] = ']';
+  buf[len] = '\0';
+}
 
-// --- NumSelector Portal  ---
+// --- NumSelector Portal 组件 ---
 static void portal_num_draw(u8g2_t *u8g2, int16_t x, int16_t y, uint8_t w,
                             uint8_t h, void *ctx) {
   if (!ctx)
@@ -67,7 +82,7 @@ static void portal_num_draw(u8g2_t *u8g2, int16_t x, int16_t y, uint8_t w,
                               current_tick, y + 1, y + 14);
 
   u8g2_SetFont(u8g2, sc->font);
-  sprintf(buf, "%.1f", val);
+  num_fmt_float(buf, sizeof(buf), val, 1, 0);
   int val_w = u8g2_GetStrWidth(u8g2, buf);
   u8g2_DrawStr(u8g2, x + (w - val_w) / 2, y + 26, buf);
 
@@ -83,7 +98,8 @@ static void portal_num_draw(u8g2_t *u8g2, int16_t x, int16_t y, uint8_t w,
   }
 
   u8g2_SetFont(u8g2, sc->sub_window_font);
-  sprintf(buf, "[%.1f,%.1f,%.1f]", data->min, data->step, data->max);
+  const float range[3] = {data->min, data->step, data->max};
+  portal_fmt_range(buf, sizeof(buf), range, 3, ',', 1);
   int range_w = u8g2_GetStrWidth(u8g2, buf);
   u8g2_DrawStr(u8g2, x + (w - range_w) / 2, y + 45, buf);
 }
@@ -95,19 +111,22 @@ static void portal_num_input(int btn, void *ctx) {
   if (!data->val_ptr)
     return;
 
+  // 多步输入一次调整 steps 个步长
+  float delta = data->step * btn_get_steps(btn);
+  btn = btn_get_type(btn);
   if (btn == BTN_UP) {
-    *(data->val_ptr) = fminf(*(data->val_ptr) + data->step, data->max);
+    *(data->val_ptr) = fminf(*(data->val_ptr) + delta, data->max);
   } else if (btn == BTN_DOWN) {
-    *(data->val_ptr) = fmaxf(*(data->val_ptr) - data->step, data->min);
+    *(data->val_ptr) = fmaxf(*(data->val_ptr) - delta, data->min);
   } else if (btn == BTN_ENTER || btn == BTN_BACK) {
     page_stack_portal_toggle(&g_page_stack, NULL, NULL, 0);
   }
 }
 
 const portal_component_t PORTAL_NUM = {
-    .draw = portal_num_draw, .input = portal_num_input, .w = 100, .h = 48};
+    .draw = portal_num_draw, .input = portal_num_input, .w = 100, .h = 48, .multi_step = true};
 
-// λֵPortal
+// 按位调整整形数值Portal
 void portal_precise_draw(u8g2_t *u8g2, int16_t x, int16_t y, uint8_t w,
                          uint8_t h, void *ctx) {
   if (!ctx)
@@ -123,12 +142,9 @@ void portal_precise_draw(u8g2_t *u8g2, int16_t x, int16_t y, uint8_t w,
   u8g2_DrawHLine(u8g2, x, y + 12, w);
 
   char buf[16];
-  char fmt[10];
-  if (data->dot_pos > 0)
-    sprintf(fmt, "%%0%d.%df", data->total_digit + 1, data->dot_pos);
-  else
-    sprintf(fmt, "%%0%d.0f", data->total_digit);
-  sprintf(buf, fmt, *data->val_ptr);
+  // 共 total_digit 位数字, 不足时补 0; 有小数时宽度包含小数点
+  num_fmt_float(buf, sizeof(buf), *data->val_ptr, data->dot_pos,
+                data->dot_pos > 0 ? data->total_digit + 1 : data->total_digit);
 
   u8g2_SetFont(u8g2, g_screen_cfg.sub_window_font);
   int str_w = u8g2_GetStrWidth(u8g2, buf);
@@ -144,7 +160,8 @@ void portal_precise_draw(u8g2_t *u8g2, int16_t x, int16_t y, uint8_t w,
   u8g2_DrawHLine(u8g2, cursor_line_x, num_y + 2, char_w);
 
   char range_buf[32];
-  sprintf(range_buf, "[%.0f~%.0f]", data->min, data->max);
+  const float range[2] = {data->min, data->max};
+  portal_fmt_range(range_buf, sizeof(range_buf), range, 2, '~', 0);
   u8g2_SetFont(u8g2, g_screen_cfg.sub_window_font);
   u8g2_DrawStr(u8g2, x + (w - u8g2_GetStrWidth(u8g2, range_buf)) / 2, y + h - 2,
                range_buf);
@@ -155,32 +172,43 @@ static void portal_precise_input(int btn, void *ctx) {
     return;
   portal_ctx_precise_t *data = (portal_ctx_precise_t *)ctx;
 
+#if UI_FIXED_MATH
+  // 10 的整数次幂查表, 四舍五入 (远离 0) 与 roundf 相同
+  uint32_t factor = fix_pow10(data->dot_pos);
+  float scaled = (*data->val_ptr) * factor;
+  int32_t val_int = (int32_t)(scaled >= 0 ? scaled + 0.5f : scaled - 0.5f);
+#else
   float factor = powf(10.0f, data->dot_pos);
   int32_t val_int = (int32_t)roundf((*data->val_ptr) * factor);
+#endif
 
   int32_t step = 1;
   for (uint8_t i = 0; i < data->cursor_pos; i++)
     step *= 10;
 
-  switch (btn) {
+  // 多步输入: 光标一次移动多位, 数值一次加减多个步长
+  uint8_t steps = btn_get_steps(btn);
+  switch (btn_get_type(btn)) {
   case BTN_LEFT:
-    if (data->cursor_pos < data->total_digit - 1)
-      data->cursor_pos++;
+    if (data->cursor_pos + 1 < data->total_digit)
+      data->cursor_pos = data->cursor_pos + steps < data->total_digit ? data->cursor_pos + steps
+                                                                      : data->total_digit - 1;
     break;
   case BTN_RIGHT:
-    if (data->cursor_pos > 0)
-      data->cursor_pos--;
+    data->cursor_pos = data->cursor_pos > steps ? data->cursor_pos - steps : 0;
     break;
   case BTN_UP:
-    val_int += step;
+    val_int += step * steps;
     break;
   case BTN_DOWN:
-    val_int -= step;
+    val_int -= step * steps;
     break;
   case BTN_ENTER:
   case BTN_BACK:
     page_stack_portal_toggle(&g_page_stack, NULL, NULL, 0);
     return;
+  default:
+    break;
   }
 
   float new_val = (float)val_int / factor;
@@ -194,7 +222,8 @@ static void portal_precise_input(int btn, void *ctx) {
 const portal_component_t PORTAL_PRECISE_NUM = {.draw = portal_precise_draw,
                                                .input = portal_precise_input,
                                                .w = 110,
-                                               .h = 45};
+                                               .h = 45,
+                                               .multi_step = true};
 
 #if ENABLE_VLIST_PROGRESS
 void portal_progress_force_refresh(void *ctx) {
@@ -218,6 +247,7 @@ void Progress_Log(void *ctx, const char *fmt, ...) {
   va_start(args, fmt);
   vsnprintf(p->detail, sizeof(p->detail), fmt, args);
   va_end(args);
+  str_width_invalidate(p->detail);
 
   if (p->status == PROG_STATUS_WAIT)
     p->status = PROG_STATUS_WAIT;
@@ -228,6 +258,7 @@ void Progress_SetSuccess(void *ctx) {
   portal_ctx_progress_t *p = (portal_ctx_progress_t *)ctx;
   p->status = PROG_STATUS_SUCCESS;
   snprintf(p->detail, sizeof(p->detail), "DONE");
+  str_width_invalidate(p->detail);
   portal_progress_force_refresh(ctx);
 }
 
@@ -235,6 +266,7 @@ void Progress_SetFailed(void *ctx, const char *reason) {
   portal_ctx_progress_t *p = (portal_ctx_progress_t *)ctx;
   p->status = PROG_STATUS_FAIL;
   snprintf(p->detail, sizeof(p->detail), reason);
+  str_width_invalidate(p->detail);
   portal_progress_force_refresh(ctx);
 }
 
@@ -256,17 +288,17 @@ static void portal_progress_draw(u8g2_t *u8g2, int16_t x, int16_t y, uint8_t w,
   if (p->status == PROG_STATUS_WAIT && !p->is_running) {
     u8g2_SetFont(u8g2, g_screen_cfg.sub_window_font);
     const char *tip = "Press[ENTER]to Start";
-    int tw = u8g2_GetStrWidth(u8g2, tip);
+    int tw = str_width_get(u8g2, tip);
     u8g2_DrawStr(u8g2, x + (w - tw) / 2, y + 34, tip);
   } else {
     u8g2_SetFont(u8g2, g_screen_cfg.font);
-    int dw = u8g2_GetStrWidth(u8g2, p->detail);
+    int dw = str_width_get(u8g2, p->detail);
     u8g2_DrawStr(u8g2, x + (w - dw) / 2, y + 34, p->detail);
   }
 
   if (p->status == PROG_STATUS_FAIL) {
     u8g2_SetFont(u8g2, g_screen_cfg.font);
-    u8g2_DrawStr(u8g2, x + (w - u8g2_GetStrWidth(u8g2, "FAILED")) / 2, y + 45,
+    u8g2_DrawStr(u8g2, x + (w - str_width_get(u8g2, "FAILED")) / 2, y + 45,
                  "FAILED");
   }
 }
@@ -298,5 +330,6 @@ static void portal_progress_input(int btn, void *ctx) {
 const portal_component_t PORTAL_PROGRESS = {.draw = portal_progress_draw,
                                             .input = portal_progress_input,
                                             .w = 110,
-                                            .h = 48};
+                                            .h = 48,
+                                            .multi_step = false};
 #endif
\ No newline at end of file
@@ -1,30 +1,30 @@
 #ifndef __PORTAL_COMPONENT_H__
 #define __PORTAL_COMPONENT_H__
 
-// ==========  ͷļ ==========
+// ==========  头部文件 ==========
 #include "page_stack.h"
 #include "screen.h"
 #include "stdbool.h"
 #include "u8g2.h"
 #include "ui_toolkit.h"
 
-// VLIST_PROGERSS
+// 启用VLIST_PROGERSS相关组件
 #define ENABLE_VLIST_PROGRESS 1
 
-// ========== ΪPortalͨԣʱҪĽṹ
+// ========== 为了Portal组件的通用性，创建组件时需要定义该组件的上下文结构
 // ==========
 // ==========
-// Ϊportal_ctx_bufferڴģ˿ʹṹķʽ
-// ========== Ϣ
+// 因为定义了portal_ctx_buffer用于存放上下文，因此可以使用匿名结构体的方式定义
+// ========== 消息框所需数据
 typedef struct {
   const char *title;
   const char *msg;
 } portal_ctx_message_box_t;
 
-// ѡ
+// 数字选择器所需数据
 typedef struct {
   const char *title;
-  float *val_ptr; // Ҫ仯ֵָ
+  float *val_ptr; // 对于需要变化的值，传入它的指针
   float min;
   float max;
   float step;
@@ -35,9 +35,9 @@ typedef struct {
   float *val_ptr;
   float min;
   float max;
-  uint8_t total_digit; // ʾλ
-  uint8_t dot_pos;     // Сλ
-  uint8_t cursor_pos;  // λ
+  uint8_t total_digit; // 总显示位数
+  uint8_t dot_pos;     // 小数点后保留位数
+  uint8_t cursor_pos;  // 光标位置
 } portal_ctx_precise_t;
 
 #if ENABLE_VLIST_PROGRESS
@@ -66,7 +66,7 @@ extern const portal_component_t PORTAL_PROGRESS;
 
 #endif
 
-// ========== ⲿ  ==========
+// ========== 外部定义  ==========
 extern const portal_component_t PORTAL_MESSAGE_BOX;
 extern const portal_component_t PORTAL_NUM;
 extern const portal_component_t PORTAL_PRECISE_NUM;
@@ -3,91 +3,97 @@
 #include "u8g2.h"
 #include "stdbool.h"
 
+// ===================== 运算配置 =====================
+// 动画插值、缓动与三角函数使用 Q16.16 定点运算 (fixmath.h / easing_q16.h).
+// STM32F103 没有 FPU, 浮点运算由软件库完成; 为 0 时使用原来的浮点实现
+#ifndef UI_FIXED_MATH
+#define UI_FIXED_MATH 1
+#endif
 
 typedef void (*screen_draw_text_cb_t)(u8g2_t *u8g2, uint16_t x, uint16_t y, const char *text);
 
-// ===================== Ļ/ýṹ =====================
+// ===================== 屏幕/字体配置结构体 =====================
 typedef struct {
-  // Ļ
-  uint16_t width;  // Ļ
-  uint16_t height; // Ļ߶
+  // 屏幕基础配置
+  uint16_t width;  // 屏幕宽度
+  uint16_t height; // 屏幕高度
   
-  // 
-  const uint8_t *font;   // ʹõ
-  uint8_t font_height;   // ߶
-  uint8_t font_baseline; // ƫ
-	const uint8_t *sub_window_font;	// Ӵʹõ
-	const uint8_t *icon_font;		// ͼ
+  // 字体配置
+  const uint8_t *font;   // 使用的字体
+  uint8_t font_height;   // 字体高度
+  uint8_t font_baseline; // 字体基线偏移
+	const uint8_t *sub_window_font;	// 子窗口使用的字体
+	const uint8_t *icon_font;		// 图标字体名
   
-  // ı
-  bool is_utf8;                  // UTF8־true=ʹUTF8ƣfalse=ʹͨASCII
-  screen_draw_text_cb_t draw_text; // Զֻƻص
+  // 文本编码配置
+  bool is_utf8;                  // UTF8编码标志：true=使用UTF8绘制，false=使用普通ASCII
+  screen_draw_text_cb_t draw_text; // 自定义文字绘制回调
   
-  // ֻ
-  uint8_t title_left_margin;       // ߾
-  uint8_t right_item_margin;       // ҲԪҲ߾
-  uint8_t right_item_left_padding; // ҲԪڱ߾
+  // 布局基础配置
+  uint8_t title_left_margin;       // 标题左侧边距
+  uint8_t right_item_margin;       // 右侧元素右侧边距
+  uint8_t right_item_left_padding; // 右侧元素左侧内边距
   
-  // 
-  uint16_t scroll_pause_ticks;  // ͣʱ䣨ms
-  uint8_t scroll_speed_divisor; // ٶȳ
+  // 滚动配置
+  uint16_t scroll_pause_ticks;  // 滚动停顿时间（ms）
+  uint8_t scroll_speed_divisor; // 滚动速度（每像素ms）
   
-  // 
-  uint8_t animation_duration; // 򶯻ʱtick
+  // 动画配置
+  uint16_t animation_duration; // 高亮框动画时长（ms）
   
-  // 
-  uint8_t highlight_padding; // ڱ߾
-  uint8_t highlight_height;  // ߶
+  // 高亮框配置
+  uint8_t highlight_padding; // 高亮框内边距
+  uint8_t highlight_height;  // 高亮框高度
   uint8_t hightlight_radius;
   
-  // ҲԪĬϿ
-  uint8_t click_switch_width; // CLICKͿؿ
-  uint8_t action_width;       // ACTIONͿ
-  uint8_t num_min_width;      // NUMС
+  // 右侧元素默认宽度
+  uint8_t click_switch_width; // CLICK类型开关宽度
+  uint8_t action_width;       // ACTION类型宽度
+  uint8_t num_min_width;      // NUM类型最小宽度
 } Screen_t;
 
-// ===================== ֻʵ =====================
-// UTF8ֻƺ
+// ===================== 内置文字绘制实现 =====================
+// UTF8文字绘制函数
 static inline void screen_draw_utf8(u8g2_t *u8g2, uint16_t x, uint16_t y, const char *text) {
   if (u8g2 && text) {
     u8g2_DrawUTF8(u8g2, x, y, text);
   }
 }
 
-// ͨASCIIֻƺ
+// 普通ASCII文字绘制函数
 static inline void screen_draw_str(u8g2_t *u8g2, uint16_t x, uint16_t y, const char *text) {
   if (u8g2 && text) {
     u8g2_DrawStr(u8g2, x, y, text);
   }
 }
 
-// ===================== ĬĻ =====================
+// ===================== 默认屏幕配置 =====================
 #define DEFAULT_SCREEN_CONFIG                                                  \
   {                                                                            \
-      .width = 128,                 /* Ļ */                             \
-      .height = 64,                 /* Ļ߶ */                             \
-      .font = u8g2_font_6x10_tf, /* ʹõ */       \
+      .width = 128,                 /* 屏幕宽度 */                             \
+      .height = 64,                 /* 屏幕高度 */                             \
+      .font = u8g2_font_6x10_tf, /* 使用的字体 */       \
 	  .sub_window_font = u8g2_font_5x7_tf,										\
 	  .icon_font = u8g2_font_open_iconic_all_4x_t, \
-      .font_height = 10,            /* ߶ */                             \
-      .font_baseline = 10,          /*  */                             \
-      .is_utf8 = false,              /* UTF8ñ־ */       \
-      .draw_text = screen_draw_str,/* ֻƻص */           \
-      .title_left_margin = 13,      /* ߾ */                         \
-      .right_item_margin = 5,       /* ҲԪҲ߾ */                     \
-      .right_item_left_padding = 8, /* ҲԪڱ߾ */                   \
-      .scroll_pause_ticks = 200,    /* ͣ200ms */                        \
-      .scroll_speed_divisor = 3,    /* ٶȳ */                         \
-      .animation_duration = 12,     /* ʱ12tick */                       \
-      .highlight_padding = 15,      /* ڱ߾ */                         \
-      .highlight_height = 13,       /* ߶ */                           \
+      .font_height = 10,            /* 字体高度 */                             \
+      .font_baseline = 10,          /* 字体基线 */                             \
+      .is_utf8 = false,              /* UTF8启用标志 */       \
+      .draw_text = screen_draw_str,/* 文字绘制回调 */           \
+      .title_left_margin = 13,      /* 标题左侧边距 */                         \
+      .right_item_margin = 5,       /* 右侧元素右侧边距 */                     \
+      .right_item_left_padding = 8, /* 右侧元素左侧内边距 */                   \
+      .scroll_pause_ticks = 1500,   /* 滚动停顿1500ms */                       \
+      .scroll_speed_divisor = 40,   /* 滚动速度40ms/像素 */                    \
+      .animation_duration = 250,    /* 动画时长250ms */                        \
+      .highlight_padding = 15,      /* 高亮框内边距 */                         \
+      .highlight_height = 13,       /* 高亮框高度 */                           \
 	  .hightlight_radius = 3,													\
-      .click_switch_width = 10,     /* CLICKؿ */                        \
-      .action_width = 0,            /* ACTIONҲԪ */                 \
-      .num_min_width = 30           /* NUMС */                      \
+      .click_switch_width = 10,     /* CLICK开关宽度 */                        \
+      .action_width = 0,            /* ACTION类型无右侧元素 */                 \
+      .num_min_width = 30           /* NUM类型最小宽度 */                      \
   }
 
-// ȫĻʵ
+// 全局屏幕配置实例
 extern const Screen_t g_screen_cfg;
 
 #endif
\ No newline at end of file
@@ -4,33 +4,42 @@
 #include <stdio.h>
 #include <string.h>
 
-// =====================  =====================
+// ===================== 配置 =====================
 #define LOG_LINE_SPACING 2
 #define MAX_LOG_LINES                                                          \
   (g_screen_cfg.height / (g_screen_cfg.font_height + LOG_LINE_SPACING))
 #define MAX_CHAR_PER_LINE 25
 
-// ̬
+// 静态缓冲区
 static char s_lines[12][MAX_CHAR_PER_LINE + 1];
 static uint8_t s_current_rows = 0;
 static u8g2_t *s_u8g2 = NULL;
 
+// 复制最多 MAX_CHAR_PER_LINE 个字符并补结束符
+static void _copy_line(char *dst, const char *src) {
+  uint8_t n = 0;
+
+  while (n < MAX_CHAR_PER_LINE && src[n] != '\0') {
+    dst[n] = src[n];
+    n++;
+  }
+  dst[n] = '\0';
+}
+
 /**
- * @brief õĵ뻺ƽ
+ * @brief 将处理好的单行推入缓冲区，如果满了则整体平滑上移
  */
 static void _push_single_line(const char *single_line) {
   uint8_t max_rows = MAX_LOG_LINES;
 
   if (s_current_rows < max_rows) {
-    // пλ
-    strncpy(s_lines[s_current_rows], single_line, MAX_CHAR_PER_LINE);
-    s_lines[s_current_rows][MAX_CHAR_PER_LINE] = '\0';
+    // 还有空位
+    _copy_line(s_lines[s_current_rows], single_line);
     s_current_rows++;
   } else {
-    // Ļ
+    // 屏幕满了
     memmove(&s_lines[0], &s_lines[1], sizeof(s_lines[0]) * (max_rows - 1));
-    strncpy(s_lines[max_rows - 1], single_line, MAX_CHAR_PER_LINE);
-    s_lines[max_rows - 1][MAX_CHAR_PER_LINE] = '\0';
+    _copy_line(s_lines[max_rows - 1], single_line);
   }
 }
 
@@ -55,7 +64,7 @@ void splash_log_printf(const char *fmt, ...) {
   char *ptr = long_buffer;
   while (*ptr != '\0') {
     char tmp_seg[MAX_CHAR_PER_LINE + 1] = {0};
-    strncpy(tmp_seg, ptr, MAX_CHAR_PER_LINE);
+    _copy_line(tmp_seg, ptr);
 
     _push_single_line(tmp_seg);
 
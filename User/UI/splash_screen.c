@@ -2,13 +2,13 @@
 #include "btn_fifo.h"
 #include <string.h>
 
-// ===================== ̬ȫֱ =====================
-static hlist_t *s_hlist_ctx = NULL;       // תĿHList
-static splash_draw_cb_t s_draw_cb = NULL; // ûעĻƺ
+// ===================== 静态全局变量 =====================
+static hlist_t *s_hlist_ctx = NULL;       // 跳转目标HList上下文
+static splash_draw_cb_t s_draw_cb = NULL; // 用户注册的绘制函数
 
-// ===================== ߼ =====================
+// ===================== 组件核心逻辑 =====================
 /**
- * @brief SplashScreenƺ
+ * @brief SplashScreen绘制函数
  */
 static void splash_screen_draw(u8g2_t *u8g2, void *ctx) {
   (void)ctx;
@@ -18,7 +18,7 @@ static void splash_screen_draw(u8g2_t *u8g2, void *ctx) {
 }
 
 /**
- * @brief SplashScreen봦
+ * @brief SplashScreen输入处理函数
  */
 static void splash_screen_input(int btn, void *ctx) {
   (void)ctx;
@@ -28,7 +28,7 @@ static void splash_screen_input(int btn, void *ctx) {
 }
 
 /**
- * @brief ʼSplashScreen
+ * @brief 初始化SplashScreen
  */
 void splash_screen_init(hlist_t *hlist_ctx, splash_draw_cb_t draw_cb) {
   s_hlist_ctx = hlist_ctx;
@@ -36,7 +36,7 @@ void splash_screen_init(hlist_t *hlist_ctx, splash_draw_cb_t draw_cb) {
 }
 
 /**
- * @brief תSplashScreen
+ * @brief 跳转到SplashScreen
  */
 void splash_screen_jump(void) {
   g_page_stack.top = 0;
@@ -45,5 +45,6 @@ void splash_screen_jump(void) {
 
 const page_component_t SPLASH_SCREEN_COMP = {
     .draw = splash_screen_draw,
-    .input = splash_screen_input
+    .input = splash_screen_input,
+    .multi_step = false
 };
\ No newline at end of file
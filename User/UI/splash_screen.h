@@ -6,23 +6,23 @@
 #include "screen.h"
 #include "u8g2.h"
 
-// Զƺ
+// 自定义绘制函数类型
 typedef void (*splash_draw_cb_t)(u8g2_t *u8g2, const Screen_t *screen_cfg);
 
 /**
- * @brief SplashScreenʵ
+ * @brief SplashScreen组件实例
  */
 extern const page_component_t SPLASH_SCREEN_COMP;
 
 /**
- * @brief ʼSplashScreen
- * @param hlist_ctx ҪתHList
- * @param draw_cb ûԶĻƺ
+ * @brief 初始化SplashScreen
+ * @param hlist_ctx 要跳转的HList上下文
+ * @param draw_cb 用户自定义的绘制函数
  */
 void splash_screen_init(hlist_t *hlist_ctx, splash_draw_cb_t draw_cb);
 
 /**
- * @brief תSplashScreen
+ * @brief 跳转到SplashScreen
  */
 void splash_screen_jump(void);
 
@@ -0,0 +1,47 @@
+#include "str_width.h"
+#include <stdint.h>
+#include <string.h>
+
+#if STR_WIDTH_CACHE_SIZE
+typedef struct {
+  const uint8_t *font;
+  const char *str; // NULL 表示空项
+  u8g2_uint_t width;
+} str_width_entry_t;
+
+static str_width_entry_t g_str_width_cache[STR_WIDTH_CACHE_SIZE];
+
+static uint8_t str_width_hash(const uint8_t *font, const char *str) {
+  uintptr_t h = (uintptr_t)str ^ ((uintptr_t)str >> 5) ^ ((uintptr_t)font >> 2);
+  return (uint8_t)(h & (STR_WIDTH_CACHE_SIZE - 1));
+}
+#endif
+
+u8g2_uint_t str_width_get(u8g2_t *u8g2, const char *str) {
+#if STR_WIDTH_CACHE_SIZE
+  str_width_entry_t *e = &g_str_width_cache[str_width_hash(u8g2->font, str)];
+  if (e->str != str || e->font != u8g2->font) {
+    // 未命中时覆盖该项
+    e->font = u8g2->font;
+    e->str = str;
+    e->width = u8g2_GetStrWidth(u8g2, str);
+  }
+  return e->width;
+#else
+  return u8g2_GetStrWidth(u8g2, str);
+#endif
+}
+
+void str_width_invalidate(const char *str) {
+#if STR_WIDTH_CACHE_SIZE
+  if (str == NULL) {
+    memset(g_str_width_cache, 0, sizeof(g_str_width_cache));
+    return;
+  }
+  // 同一地址在不同字体下可能占用多项
+  for (uint8_t i = 0; i < STR_WIDTH_CACHE_SIZE; i++)
+    if (g_str_width_cache[i].str == str) g_str_width_cache[i].str = NULL;
+#else
+  (void)str;
+#endif
+}
@@ -0,0 +1,24 @@
+#ifndef __STR_WIDTH_H__
+#define __STR_WIDTH_H__
+
+#include "u8g2.h"
+
+// ========== 配置项 ==========
+// 字符串宽度缓存: 以 (字体, 字符串地址) 为键缓存 u8g2_GetStrWidth 的结果.
+// 只比较地址, 适用于字符串常量与 const 标题; 可变缓冲区修改内容后须调用 str_width_invalidate
+#ifndef STR_WIDTH_CACHE_SIZE
+#define STR_WIDTH_CACHE_SIZE 32 // 缓存项数 (直接映射, 2 的幂), 为 0 时不缓存
+#endif
+
+/**
+ * @brief 当前字体下字符串的宽度, 结果与 u8g2_GetStrWidth 相同
+ */
+u8g2_uint_t str_width_get(u8g2_t *u8g2, const char *str);
+
+/**
+ * @brief 使该地址在所有字体下的缓存失效
+ * @param str 缓冲区地址, 为 NULL 时清空全部缓存
+ */
+void str_width_invalidate(const char *str);
+
+#endif
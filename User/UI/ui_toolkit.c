@@ -1,4 +1,246 @@
 #include "ui_toolkit.h"
+#include <string.h>
+
+#if MARQUEE_STRIP_SLOTS
+// 条带按文字的实际尺寸存放在 g_marquee_arena 中: 前景为页格式 (pages 页, 每页 width 字节,
+// 低位在上); 非透明字体模式下之后每列再用 1 字节保存字形框的行范围 (高 4 位首行, 低 4 位末行),
+// 框内不是前景的像素为背景. 首尾间隔不保存
+typedef struct {
+  const uint8_t *font; // NULL 表示空项
+  char text[MARQUEE_TEXT_LEN];
+  uint16_t offset; // 在 g_marquee_arena 中的起始位置
+  uint8_t width;   // 条带宽度 (文字宽度)
+  uint8_t pages;   // 条带高度 (页)
+  int8_t ascent;   // 基线到条带顶端的行数
+  bool is_solid;   // 光栅化时为非透明字体模式, 带有字形框的行范围
+  uint32_t last_use;
+} marquee_strip_t;
+
+#define MARQUEE_BOX_EMPTY 0xf0 // 该列没有字形框 (首行大于末行)
+
+static marquee_strip_t g_marquee_strips[MARQUEE_STRIP_SLOTS];
+static uint8_t g_marquee_strip_num; // g_marquee_strips 中前 g_marquee_strip_num 项有效
+static uint16_t g_marquee_used;     // g_marquee_arena 已使用的字节数
+static uint32_t g_marquee_use_cnt;
+static u8g2_t g_marquee_u8g2; // 光栅化用的 u8g2 副本
+static uint8_t g_marquee_arena[MARQUEE_STRIP_ARENA];
+
+static uint16_t marquee_strip_bytes(uint8_t width, uint8_t pages, bool is_solid) {
+  return (uint16_t)width * pages + (is_solid ? width : 0);
+}
+
+// 与字形缓存相同: 删除条带并合并数据区的空隙, 最后一项移到空出的位置
+static void marquee_strip_remove(uint8_t i) {
+  marquee_strip_t *s = &g_marquee_strips[i];
+  uint16_t offset = s->offset;
+  uint16_t size = marquee_strip_bytes(s->width, s->pages, s->is_solid);
+
+  memmove(g_marquee_arena + offset, g_marquee_arena + offset + size, g_marquee_used - offset - size);
+  g_marquee_used -= size;
+  g_marquee_strip_num--;
+  *s = g_marquee_strips[g_marquee_strip_num];
+  for (i = 0; i < g_marquee_strip_num; i++)
+    if (g_marquee_strips[i].offset > offset) g_marquee_strips[i].offset -= size;
+}
+
+/**
+ * @brief 以 u8g2 的当前状态把文字画到 buf (页格式, 每页 s->width 字节), 字体模式为非透明
+ * @param fill 绘制前的像素值
+ * @param color 绘制颜色
+ */
+static void marquee_render(const u8g2_t *u8g2, const marquee_strip_t *s, const char *text,
+                           uint8_t *buf, uint8_t fill, uint8_t color) {
+  u8g2_t *m = &g_marquee_u8g2;
+  ui_offscreen_init(m, u8g2, buf, s->width, s->width, s->pages);
+  u8g2_SetFontMode(m, 0);
+  u8g2_SetDrawColor(m, color);
+  memset(buf, fill, (size_t)s->width * s->pages);
+  // 基线位于条带第 ascent 行, 与 DrawStr 一样加上字体参考线偏移
+  g_screen_cfg.draw_text(m, 0, (u8g2_uint_t)(s->ascent - m->font_calc_vref(m)), text);
+}
+
+/**
+ * @brief 在全 1 的缓冲区上以颜色 2 绘制: 前景翻转为 0, 背景为 0, 字形框外仍为 1.
+ *        每列的字形框转换为行范围写入 box
+ * @return 某列的字形框不连续 (如上下分开的两个字形) 时返回 false
+ */
+static bool marquee_render_box(const u8g2_t *u8g2, const marquee_strip_t *s, const char *text,
+                               uint8_t *buf, uint8_t *box) {
+  marquee_render(u8g2, s, text, buf, 0xff, 2);
+  for (int c = 0; c < s->width; c++) {
+    uint16_t v = (uint16_t)~(buf[c] | (s->pages > 1 ? buf[s->width + c] << 8 : 0xff00));
+    uint8_t top = 0, bottom = 15;
+    if (v == 0) {
+      box[c] = MARQUEE_BOX_EMPTY;
+      continue;
+    }
+    while (!(v & (1u << top))) top++;
+    while (!(v & (1u << bottom))) bottom--;
+    if (v != (uint16_t)((2u << bottom) - (1u << top))) return false;
+    box[c] = (uint8_t)(top << 4 | bottom);
+  }
+  return true;
+}
+
+/**
+ * @brief 取文字的条带, 不存在时光栅化, 数据区不足时淘汰最久未使用的条带
+ * @return 无法缓存时返回 NULL
+ */
+static const marquee_strip_t *marquee_strip_get(u8g2_t *u8g2, const char *text, int text_width) {
+  marquee_strip_t *s;
+  uint8_t height = u8g2_GetMaxCharHeight(u8g2);
+  uint8_t pages = (height + 7) >> 3;
+  bool is_solid = u8g2->font_decode.is_transparent == 0;
+  uint16_t size;
+  uint8_t *buf;
+
+  // 条带只支持不旋转的竖直字节缓冲区
+  if (u8g2->cb != U8G2_R0 || u8g2->ll_hvline != u8g2_ll_hvline_vertical_top_lsb)
+    return NULL;
+  if (text_width > MARQUEE_STRIP_MAX_W || height > MARQUEE_STRIP_PAGES * 8 ||
+      strlen(text) >= MARQUEE_TEXT_LEN)
+    return NULL;
+  size = marquee_strip_bytes((uint8_t)text_width, pages, is_solid);
+  if (size > MARQUEE_STRIP_ARENA) return NULL;
+
+  g_marquee_use_cnt++;
+  for (uint8_t i = 0; i < g_marquee_strip_num; i++) {
+    s = &g_marquee_strips[i];
+    if (s->font == u8g2->font && s->is_solid == is_solid && strcmp(s->text, text) == 0) {
+      s->last_use = g_marquee_use_cnt;
+      return s;
+    }
+  }
+
+  while (g_marquee_strip_num >= MARQUEE_STRIP_SLOTS || g_marquee_used + size > MARQUEE_STRIP_ARENA) {
+    uint8_t lru = 0;
+    for (uint8_t i = 1; i < g_marquee_strip_num; i++)
+      if (g_marquee_strips[i].last_use < g_marquee_strips[lru].last_use) lru = i;
+    marquee_strip_remove(lru);
+  }
+
+  s = &g_marquee_strips[g_marquee_strip_num];
+  s->width = (uint8_t)text_width;
+  s->pages = pages;
+  s->ascent = (int8_t)(height + u8g2->font_info.y_offset);
+  s->is_solid = is_solid;
+  s->offset = g_marquee_used;
+  buf = g_marquee_arena + s->offset;
+  // 先求字形框 (暂用前景的位置), 再绘制前景
+  if (is_solid && !marquee_render_box(u8g2, s, text, buf, buf + (uint16_t)s->width * pages))
+    return NULL;
+  marquee_render(u8g2, s, text, buf, 0, 1);
+  s->font = u8g2->font;
+  strcpy(s->text, text);
+  s->last_use = g_marquee_use_cnt;
+  g_marquee_used += size;
+  g_marquee_strip_num++;
+  return s;
+}
+
+/**
+ * @brief 把条带按周期 period 重复拷贝到缓冲区, 第一份的左端在 x, 基线在 y.
+ *        按当前裁剪窗口、绘制颜色与字体模式写入, 与逐字绘制的结果相同
+ */
+static void marquee_blit(u8g2_t *u8g2, const marquee_strip_t *s, int x, int y, int period) {
+  const uint8_t *fg0 = g_marquee_arena + s->offset;
+  const uint8_t *fg1 = s->pages > 1 ? fg0 + s->width : NULL;
+  const uint8_t *box = s->is_solid ? fg0 + (uint16_t)s->width * s->pages : NULL;
+  int x0, x1, y0, y1, top;
+  uint8_t fg_or, fg_xor, bg_or, bg_xor;
+
+#ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
+  if (u8g2->is_page_clip_window_intersection == 0) return;
+#endif
+  top = y + (int16_t)u8g2->font_calc_vref(u8g2) - s->ascent;
+  x0 = u8g2->user_x0;
+  x1 = u8g2->user_x1;
+  y0 = u8g2->user_y0 > top ? u8g2->user_y0 : top;
+  y1 = u8g2->user_y1 < top + s->pages * 8 ? u8g2->user_y1 : top + s->pages * 8;
+  if (x0 >= x1 || y0 >= y1 || x0 < x) return;
+
+  // 转换为缓冲区坐标
+  top -= u8g2->pixel_curr_row;
+  y0 -= u8g2->pixel_curr_row;
+  y1 -= u8g2->pixel_curr_row;
+
+  // 与字形缓存相同: pixel |= or_mask; pixel ^= xor_mask
+  fg_or = u8g2->draw_color <= 1 ? 0xff : 0;
+  fg_xor = u8g2->draw_color != 1 ? 0xff : 0;
+  bg_or = 0;
+  bg_xor = 0;
+  if (box != NULL) { // 非透明字体模式 (条带按字体模式查找)
+    bg_or = 0xff;
+    if (u8g2->draw_color != 0) bg_xor = 0xff;
+  }
+
+  for (int page = y0 >> 3; page * 8 < y1; page++) {
+    uint8_t mask = 0xff;
+    if (page * 8 < y0) mask <<= y0 & 7;
+    if (page * 8 + 8 > y1) mask &= 0xff >> (page * 8 + 8 - y1);
+
+    // 本页第 0 行对应条带的第 k 行 (k > -8)
+    uint8_t shift = page * 8 - top + 8;
+    uint8_t *dst = u8g2->tile_buf_ptr + page * u8g2->pixel_buf_width;
+    int dirty_tile = -1; // 已标记的最后一个 tile, 间隔所在的 tile 不标记
+    int c = x0;
+    int col = (x0 - x) % period;
+    while (c < x1) {
+      if (col >= s->width) { // 跳过间隔
+        c += period - col;
+        col = 0;
+        continue;
+      }
+      int end = c + (s->width - col);
+      if (end > x1) end = x1;
+      for (; c < end; c++, col++) {
+        uint32_t fv = fg0[col] | (fg1 != NULL ? (uint32_t)fg1[col] << 8 : 0);
+        uint32_t bv = 0;
+        if (box != NULL && box[col] != MARQUEE_BOX_EMPTY)
+          bv = ((2u << (box[col] & 0x0f)) - (1u << (box[col] >> 4))) & ~fv;
+        uint8_t f = (uint8_t)((fv << 8) >> shift) & mask;
+        uint8_t b = (uint8_t)((bv << 8) >> shift) & mask;
+        if ((f | b) == 0) continue;
+        uint8_t d = dst[c];
+        d |= f & fg_or;
+        d ^= f & fg_xor;
+        d |= b & bg_or;
+        d ^= b & bg_xor;
+        dst[c] = d;
+        // 与逐字绘制相同, 只标记画到像素的 tile
+        if ((c >> 3) != dirty_tile) {
+          dirty_tile = c >> 3;
+          u8g2_MarkDirtyBox(u8g2, c, page * 8, 1, 1);
+        }
+      }
+    }
+  }
+}
+#endif
+
+void ui_offscreen_init(u8g2_t *off, const u8g2_t *u8g2, uint8_t *buf, uint8_t buf_width,
+                       uint8_t width, uint8_t pages) {
+  memcpy(off, u8g2, sizeof(*off));
+  off->tile_buf_ptr = buf;
+  off->tile_buf_height = pages;
+  off->tile_curr_row = 0;
+  off->pixel_buf_width = buf_width;
+  off->pixel_buf_height = pages * 8;
+  off->pixel_curr_row = 0;
+  off->buf_y0 = 0;
+  off->buf_y1 = pages * 8;
+  off->width = width;
+  off->height = pages * 8;
+  u8g2_SetMaxClipWindow(off);
+}
+
+void marquee_strip_clear(void) {
+#if MARQUEE_STRIP_SLOTS
+  memset(g_marquee_strips, 0, sizeof(g_marquee_strips));
+  g_marquee_strip_num = 0;
+  g_marquee_used = 0;
+#endif
+}
 
 void draw_scroll_text_with_pause(u8g2_t *u8g2, const Screen_t *screen_cfg,
                                  const char *text, uint8_t start_x,
@@ -7,32 +249,39 @@ void draw_scroll_text_with_pause(u8g2_t *u8g2, const Screen_t *screen_cfg,
   if (u8g2 == NULL || screen_cfg == NULL || text == NULL || max_width == 0)
     return;
 
-  int text_width = u8g2_GetStrWidth(u8g2, text);
+  int text_width = str_width_get(u8g2, text);
   if (text_width <= max_width) {
     g_screen_cfg.draw_text(u8g2, start_x, y, text);
     return;
   }
 
+  // 文字超出宽度时持续滚动, 需要逐帧重绘
+  page_stack_request_frame(&g_page_stack);
+
   int gap = 20;
   int total_len = text_width + gap;
   int pause_ticks = screen_cfg->scroll_pause_ticks;
   int scroll_ticks = total_len * screen_cfg->scroll_speed_divisor;
   int total_cycle_ticks = pause_ticks + scroll_ticks;
   uint32_t cycle_tick = tick % total_cycle_ticks;
+  int draw_x = start_x;
 
-  if (cycle_tick < pause_ticks) {
-    u8g2_SetClipWindow(u8g2, start_x, clip_y1, start_x + max_width, clip_y2);
-    g_screen_cfg.draw_text(u8g2, start_x, y, text);
-    u8g2_SetMaxClipWindow(u8g2);
-    return;
+  if (cycle_tick >= pause_ticks) {
+    uint32_t scroll_start_tick = cycle_tick - pause_ticks;
+    int offset = scroll_start_tick / screen_cfg->scroll_speed_divisor;
+    draw_x = start_x - offset;
   }
 
-  uint32_t scroll_start_tick = cycle_tick - pause_ticks;
-  int offset = scroll_start_tick / screen_cfg->scroll_speed_divisor;
-  int draw_x = start_x - offset;
-
   u8g2_SetClipWindow(u8g2, start_x, clip_y1, start_x + max_width, clip_y2);
+#if MARQUEE_STRIP_SLOTS
+  const marquee_strip_t *strip = marquee_strip_get(u8g2, text, text_width);
+  if (strip != NULL) {
+    marquee_blit(u8g2, strip, draw_x, y, total_len);
+    u8g2_SetMaxClipWindow(u8g2);
+    return;
+  }
+#endif
   g_screen_cfg.draw_text(u8g2, draw_x, y, text);
-  g_screen_cfg.draw_text(u8g2, draw_x + total_len, y, text);
+  if (draw_x != start_x) g_screen_cfg.draw_text(u8g2, draw_x + total_len, y, text);
   u8g2_SetMaxClipWindow(u8g2);
-}
\ No newline at end of file
+}
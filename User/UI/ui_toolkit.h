@@ -1,11 +1,44 @@
 #ifndef __UI_TOOLKIT_H__
 #define __UI_TOOLKIT_H__
+#include "page_stack.h"
 #include "screen.h"
+#include "str_width.h"
 #include "u8g2.h"
 
-// ƹֺ,ͣ
+// ========== 配置项 ==========
+// 滚动文字条带缓存: 超出宽度的文字按 (字体, 字体模式, 内容) 光栅化一次为条带, 之后每帧按位移拷贝可见部分.
+// 条带按文字宽度从数据区分配, 每列占 页数 字节, 非透明字体模式再加 1 字节;
+// 按最近使用淘汰; 条带太宽/太高或文字太长时按原方式逐字绘制
+#ifndef MARQUEE_STRIP_SLOTS
+#define MARQUEE_STRIP_SLOTS 3 // 条带数 (高亮行与其他几个滚动的文字), 为 0 时不缓存
+#endif
+#ifndef MARQUEE_STRIP_ARENA
+#define MARQUEE_STRIP_ARENA 1024 // 条带数据区 (字节), 6x10 字体 22 个字符的非透明条带约 400 字节
+#endif
+#ifndef MARQUEE_STRIP_MAX_W
+#define MARQUEE_STRIP_MAX_W 160 // 条带最大宽度 (像素)
+#endif
+#define MARQUEE_STRIP_PAGES 2 // 条带最大高度 (页, 8 像素), 字体高度不超过 16 像素时可用
+#define MARQUEE_TEXT_LEN 32   // 可缓存的文字最大长度 (含结尾 '\0')
+
+// 绘制滚动文字函数,带停顿
+// text 的宽度经 str_width_get 按地址缓存: 传入字符串常量或内容不变的字符串;
+// 复用的缓冲区 (snprintf 生成的数值、provider 行等) 改写内容后须先调用 str_width_invalidate(text)
 void draw_scroll_text_with_pause(u8g2_t *u8g2, const Screen_t *screen_cfg,
                                  const char *text, uint8_t start_x,
                                  uint8_t max_width, uint8_t y, uint32_t tick,
                                  uint8_t clip_y1, uint8_t clip_y2);
-#endif
\ No newline at end of file
+
+/**
+ * @brief 清空滚动文字条带缓存 (如更换了 draw_text 回调)
+ */
+void marquee_strip_clear(void);
+
+/**
+ * @brief 准备离屏绘制: 复制 u8g2 的状态 (字体、颜色、模式等) 到 off, 并让 off 绘制到
+ *        页格式缓冲区 buf (每页 buf_width 字节, 共 pages 页), 可绘制区域为 width x pages*8.
+ *        用于把文字、图标预先光栅化, 要求 u8g2 未旋转
+ */
+void ui_offscreen_init(u8g2_t *off, const u8g2_t *u8g2, uint8_t *buf, uint8_t buf_width,
+                       uint8_t width, uint8_t pages);
+#endif
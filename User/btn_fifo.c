@@ -1,104 +1,165 @@
 #include "btn_fifo.h"
+#include <stddef.h>
 
-static btn_fifo_t g_btn_fifo;
+#if (BTN_FIFO_SIZE & (BTN_FIFO_SIZE - 1)) != 0 || BTN_FIFO_SIZE > 128
+#error "BTN_FIFO_SIZE must be a power of two, at most 128"
+#endif
 
-static inline void btn_fifo_enter_critical(void)
+#define BTN_FIFO_MASK (BTN_FIFO_SIZE - 1)
+
+static btn_fifo_t g_btn_fifo[BTN_FIFO_LANES];
+static btn_fifo_clock_cb_t g_btn_fifo_clock;
+static btn_fifo_tap_cb_t g_btn_fifo_tap;
+
+// head/tail 的读写顺序: 生产者先写数据再发布 tail, 消费者先读数据再释放 head
+#if defined(__CC_ARM)
+// ARMCC (单核 Cortex-M): 内存屏障保证数据与计数的访问顺序
+static inline uint8_t btn_fifo_load_acquire(volatile uint8_t *p)
 {
-    //رȫж
-    __disable_irq();
+    uint8_t v = *p;
+    __dmb(0xF);
+    return v;
 }
 
-static inline void btn_fifo_exit_critical(void)
+static inline void btn_fifo_store_release(volatile uint8_t *p, uint8_t v)
+{
+    __dmb(0xF);
+    *p = v;
+}
+#else
+static inline uint8_t btn_fifo_load_acquire(volatile uint8_t *p)
 {
-    __enable_irq();
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
 }
 
+static inline void btn_fifo_store_release(volatile uint8_t *p, uint8_t v)
+{
+    __atomic_store_n(p, v, __ATOMIC_RELEASE);
+}
+#endif
+
 void btn_fifo_init(void)
 {
-    btn_fifo_enter_critical();
-    g_btn_fifo.head = 0;
-    g_btn_fifo.tail = 0;
-    g_btn_fifo.count = 0;
-    btn_fifo_exit_critical();
+    for (uint8_t i = 0; i < BTN_FIFO_LANES; i++) {
+        g_btn_fifo[i].head = 0;
+        g_btn_fifo[i].tail = 0;
+    }
 }
 
-bool btn_fifo_push(btn_type_t btn)
+void btn_fifo_set_clock(btn_fifo_clock_cb_t cb)
 {
-    // У鰴Ч
-    if (btn <= BTN_NONE || btn >= BTN_MAX) {
+    g_btn_fifo_clock = cb;
+}
+
+void btn_fifo_set_tap(btn_fifo_tap_cb_t cb)
+{
+    g_btn_fifo_tap = cb;
+}
+
+bool btn_fifo_push_event(uint8_t lane, const btn_event_t *ev)
+{
+    // 校验按键类型有效性
+    if (lane >= BTN_FIFO_LANES || ev == NULL || ev->btn <= BTN_NONE || ev->btn >= BTN_MAX) {
         return false;
     }
 
-    btn_fifo_enter_critical();
-    
-    // FIFOǷ
-    if (g_btn_fifo.count >= BTN_FIFO_SIZE) {
-        btn_fifo_exit_critical();
+    btn_fifo_t *f = &g_btn_fifo[lane];
+    uint8_t tail = f->tail; // 只有本生产者修改 tail
+
+    // 检查FIFO是否已满
+    if ((uint8_t)(tail - btn_fifo_load_acquire(&f->head)) >= BTN_FIFO_SIZE) {
         return false;
     }
 
-    // д밴¼FIFO
-    g_btn_fifo.buf[g_btn_fifo.tail] = btn;
-    g_btn_fifo.tail = (g_btn_fifo.tail + 1) % BTN_FIFO_SIZE;
-    g_btn_fifo.count++;
-    
-    btn_fifo_exit_critical();
+    // 写入按键事件后再发布
+    f->buf[tail & BTN_FIFO_MASK] = *ev;
+    btn_fifo_store_release(&f->tail, (uint8_t)(tail + 1));
     return true;
 }
 
-btn_type_t btn_fifo_pop(void)
+static bool btn_fifo_push_lane(uint8_t lane, btn_type_t btn)
+{
+    btn_fifo_clock_cb_t clock = g_btn_fifo_clock;
+    btn_event_t ev;
+    ev.btn = btn;
+    ev.steps = 1;
+    ev.tick = clock ? clock() : 0;
+    return btn_fifo_push_event(lane, &ev);
+}
+
+bool btn_fifo_push(btn_type_t btn)
 {
-    btn_type_t btn = BTN_NONE;
-    
-    btn_fifo_enter_critical();
-    
-    // FIFOǷΪ
-    if (g_btn_fifo.count == 0) {
-        btn_fifo_exit_critical();
-        return BTN_NONE;
+    return btn_fifo_push_lane(BTN_FIFO_LANE_MAIN, btn);
+}
+
+bool btn_fifo_push_isr(btn_type_t btn)
+{
+    return btn_fifo_push_lane(BTN_FIFO_LANE_ISR, btn);
+}
+
+bool btn_fifo_pop_event(btn_event_t *ev)
+{
+    btn_fifo_t *oldest = NULL;
+
+    // 各队列内按顺序, 队列之间取队首时间戳最早的
+    for (uint8_t i = 0; i < BTN_FIFO_LANES; i++) {
+        btn_fifo_t *f = &g_btn_fifo[i];
+        uint8_t head = f->head; // 只有消费者修改 head
+        if (head == btn_fifo_load_acquire(&f->tail)) continue;
+        if (oldest == NULL ||
+            (int32_t)(f->buf[head & BTN_FIFO_MASK].tick - oldest->buf[oldest->head & BTN_FIFO_MASK].tick) < 0) {
+            oldest = f;
+        }
     }
+    if (oldest == NULL) {
+        return false;
+    }
+
+    // 读出事件后再释放位置
+    uint8_t head = oldest->head;
+    *ev = oldest->buf[head & BTN_FIFO_MASK];
+    btn_fifo_store_release(&oldest->head, (uint8_t)(head + 1));
+    if (g_btn_fifo_tap) g_btn_fifo_tap(ev);
+    return true;
+}
+
+btn_type_t btn_fifo_pop(void)
+{
+    btn_event_t ev;
+    return btn_fifo_pop_event(&ev) ? ev.btn : BTN_NONE;
+}
 
-    // FIFOȡ¼
-    btn = g_btn_fifo.buf[g_btn_fifo.head];
-    g_btn_fifo.head = (g_btn_fifo.head + 1) % BTN_FIFO_SIZE;
-    g_btn_fifo.count--;
-    
-    btn_fifo_exit_critical();
-    return btn;
+int btn_fifo_pop_input(void)
+{
+    btn_event_t ev;
+    return btn_fifo_pop_event(&ev) ? btn_pack_steps(ev.btn, ev.steps) : BTN_NONE;
 }
 
 bool btn_fifo_is_empty(void)
 {
-    bool ret;
-    btn_fifo_enter_critical();
-    ret = (g_btn_fifo.count == 0);
-    btn_fifo_exit_critical();
-    return ret;
+    return btn_fifo_get_count() == 0;
 }
 
 bool btn_fifo_is_full(void)
 {
-    bool ret;
-    btn_fifo_enter_critical();
-    ret = (g_btn_fifo.count >= BTN_FIFO_SIZE);
-    btn_fifo_exit_critical();
-    return ret;
+    btn_fifo_t *f = &g_btn_fifo[BTN_FIFO_LANE_MAIN];
+    return (uint8_t)(f->tail - btn_fifo_load_acquire(&f->head)) >= BTN_FIFO_SIZE;
 }
 
 void btn_fifo_clear(void)
 {
-    btn_fifo_enter_critical();
-    g_btn_fifo.head = 0;
-    g_btn_fifo.tail = 0;
-    g_btn_fifo.count = 0;
-    btn_fifo_exit_critical();
+    // 消费者把 head 移到当前 tail, 不影响正在写入的生产者
+    for (uint8_t i = 0; i < BTN_FIFO_LANES; i++) {
+        btn_fifo_store_release(&g_btn_fifo[i].head, btn_fifo_load_acquire(&g_btn_fifo[i].tail));
+    }
 }
 
 uint8_t btn_fifo_get_count(void)
 {
-    uint8_t count;
-    btn_fifo_enter_critical();
-    count = g_btn_fifo.count;
-    btn_fifo_exit_critical();
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < BTN_FIFO_LANES; i++) {
+        btn_fifo_t *f = &g_btn_fifo[i];
+        count += (uint8_t)(btn_fifo_load_acquire(&f->tail) - f->head);
+    }
     return count;
-}
\ No newline at end of file
+}
@@ -4,68 +4,137 @@
 #include <stdbool.h>
 #include <stdint.h>
 
-// ջ
+// 每个队列的深度, 必须是 2 的幂且不超过 128
 #define BTN_FIFO_SIZE 16
 
+// 队列数: 每个队列只有一个生产者 (写) 和一个消费者 (主循环读), 读写都不需要关中断
+#define BTN_FIFO_LANE_MAIN 0 // 主循环 (串口、编码器等轮询产生的事件)
+#define BTN_FIFO_LANE_ISR 1  // 中断 (按键扫描), 只能在同一优先级的中断中写入
+#define BTN_FIFO_LANES 2
+
 typedef enum {
-  BTN_NONE = 0, // ް
-  BTN_UP,       // ϼ
-  BTN_DOWN,     // ¼
-  BTN_LEFT,     // 
-  BTN_RIGHT,    // Ҽ
-  BTN_ENTER,    // ȷϼ
-  BTN_BACK,     // ؼ
-  BTN_CANCEL,   // ȡ
+  BTN_NONE = 0, // 无按键
+  BTN_UP,       // 上键
+  BTN_DOWN,     // 下键
+  BTN_LEFT,     // 左键
+  BTN_RIGHT,    // 右键
+  BTN_ENTER,    // 确认键
+  BTN_BACK,     // 返回键
+  BTN_CANCEL,   // 取消键
   BTN_LONG_PRESS,
-  BTN_MAX // ֵFIFO߽飩
+  BTN_MAX // 按键类型最大值（用于FIFO边界检查）
 } btn_type_t;
 
+// 带时间戳的按键事件
+typedef struct {
+  btn_type_t btn;
+  uint8_t steps; // 连续重复的次数 (如编码器一帧内转过的格数), 0 与 1 都表示一次
+  uint32_t tick; // 写入队列时的时钟 (btn_fifo_set_clock), 未设置时钟时为 0
+} btn_event_t;
+
+// 多步输入: 传给页面 input 的 btn 低 8 位为按键类型, 高位为步数 (大于 1 时)
+#define BTN_STEPS_SHIFT 8
+
+static inline int btn_pack_steps(btn_type_t btn, uint8_t steps) {
+  return steps > 1 ? (int)btn | ((int)steps << BTN_STEPS_SHIFT) : (int)btn;
+}
+static inline btn_type_t btn_get_type(int btn) { return (btn_type_t)(btn & 0xff); }
+static inline uint8_t btn_get_steps(int btn) {
+  uint8_t steps = (uint8_t)(btn >> BTN_STEPS_SHIFT);
+  return steps > 1 ? steps : 1;
+}
+
+// 单生产者单消费者环形队列, head/tail 自由递增, 下标为 & (BTN_FIFO_SIZE - 1)
 typedef struct {
-  btn_type_t buf[BTN_FIFO_SIZE]; // FIFO
-  uint8_t head;                  // ָ
-  uint8_t tail;                  // дָ
-  uint8_t count;                 // ǰԪ
+  btn_event_t buf[BTN_FIFO_SIZE]; // FIFO缓冲区
+  volatile uint8_t head;          // 读计数, 只由消费者修改
+  volatile uint8_t tail;          // 写计数, 只由生产者修改
 } btn_fifo_t;
 
-// ========== Ľӿ ==========
+// 时间戳时钟回调类型
+typedef uint32_t (*btn_fifo_clock_cb_t)(void);
+// 读出回调类型 (输入录制)
+typedef void (*btn_fifo_tap_cb_t)(const btn_event_t *ev);
+
+// ========== 核心接口 ==========
 /**
- * @brief ʼFIFO
+ * @brief 初始化按键FIFO (清空所有队列), 需在生产者开始写入之前调用
  */
 void btn_fifo_init(void);
 
 /**
- * @brief ¼
- * @param btn Ҫİ
- * @return true-ӳɹfalse-FIFO
+ * @brief 设置事件时间戳使用的时钟, 会在中断中调用
+ * @param cb 时钟回调, NULL 表示时间戳为 0
+ */
+void btn_fifo_set_clock(btn_fifo_clock_cb_t cb);
+
+/**
+ * @brief 设置读出回调, 每个被 btn_fifo_pop / btn_fifo_pop_event 取出的事件调用一次 (消费者上下文)
+ * @param cb 回调, NULL 表示不回调
+ */
+void btn_fifo_set_tap(btn_fifo_tap_cb_t cb);
+
+/**
+ * @brief 软件触发按键事件 (主循环队列)
+ * @param btn 要触发的按键类型
+ * @return true-添加成功，false-FIFO已满
  */
 bool btn_fifo_push(btn_type_t btn);
 
 /**
- * @brief ȡFIFOеİ¼
- * @return ͣBTN_NONEʾΪ
+ * @brief 在中断中触发按键事件 (中断队列)
+ * @param btn 要触发的按键类型
+ * @return true-添加成功，false-FIFO已满
+ */
+bool btn_fifo_push_isr(btn_type_t btn);
+
+/**
+ * @brief 将带时间戳的事件写入指定队列, 每个队列只能由一个上下文调用
+ * @param lane BTN_FIFO_LANE_MAIN / BTN_FIFO_LANE_ISR
+ * @param ev 事件, 时间戳不做修改
+ * @return true-添加成功，false-FIFO已满或参数无效
+ */
+bool btn_fifo_push_event(uint8_t lane, const btn_event_t *ev);
+
+/**
+ * @brief 读取FIFO中的按键事件
+ * @return 按键类型，BTN_NONE表示队列为空
  */
 btn_type_t btn_fifo_pop(void);
 
 /**
- * @brief FIFOǷΪ
- * @return true-գfalse-ǿ
+ * @brief 读取最早的事件, 按 btn_pack_steps 打包步数, 可直接传给 page_update
+ * @return 打包后的输入，BTN_NONE表示队列为空
+ */
+int btn_fifo_pop_input(void);
+
+/**
+ * @brief 读取FIFO中最早的事件 (各队列队首中时间戳最小的, 相同时主循环队列优先)
+ * @param ev 读出的事件
+ * @return true-读取成功，false-队列为空
+ */
+bool btn_fifo_pop_event(btn_event_t *ev);
+
+/**
+ * @brief 检查FIFO是否为空
+ * @return true-空，false-非空
  */
 bool btn_fifo_is_empty(void);
 
 /**
- * @brief FIFOǷ
- * @return true-false-δ
+ * @brief 检查主循环队列是否已满
+ * @return true-满，false-未满
  */
 bool btn_fifo_is_full(void);
 
 /**
- * @brief հFIFO
+ * @brief 清空按键FIFO (由消费者调用, 丢弃已写入的事件)
  */
 void btn_fifo_clear(void);
 
 /**
- * @brief ȡFIFOеǰ¼
- * @return ¼
+ * @brief 获取FIFO中当前按键事件数量
+ * @return 事件数量
  */
 uint8_t btn_fifo_get_count(void);
 
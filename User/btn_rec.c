@@ -0,0 +1,165 @@
+#include "btn_rec.h"
+#include <stddef.h>
+
+static const uint8_t g_rec_header[BTN_REC_HEADER_SIZE] = {'B', 'R', BTN_REC_VERSION};
+
+static uint8_t g_rec_buf[BTN_REC_BUF_SIZE];
+static uint16_t g_rec_len;
+static uint16_t g_rec_dropped;
+static uint32_t g_rec_prev_tick;
+static btn_rec_sink_cb_t g_rec_sink;
+static bool g_rec_running;
+
+#define BTN_REC_FLAG_STEPS 0x10
+
+uint8_t btn_rec_encode(uint8_t *out, const btn_event_t *ev, uint32_t prev_tick)
+{
+    uint8_t n = 0;
+    uint32_t delta = ((int32_t)(ev->tick - prev_tick) > 0) ? ev->tick - prev_tick : 0;
+
+    out[n++] = (uint8_t)((ev->btn & 0x0f) | (ev->steps > 1 ? BTN_REC_FLAG_STEPS : 0));
+    do {
+        uint8_t b = delta & 0x7f;
+        delta >>= 7;
+        out[n++] = delta ? (uint8_t)(b | 0x80) : b;
+    } while (delta);
+    if (ev->steps > 1) {
+        out[n++] = ev->steps;
+    }
+    return n;
+}
+
+// reserve: RAM 缓冲区中为结束标记保留的字节数
+static bool btn_rec_write(const btn_event_t *ev, uint8_t reserve)
+{
+    uint8_t rec[BTN_REC_MAX_RECORD];
+    uint8_t n = btn_rec_encode(rec, ev, g_rec_prev_tick);
+
+    if (g_rec_sink) {
+        g_rec_sink(rec, n);
+    } else if (g_rec_len + n + reserve <= BTN_REC_BUF_SIZE) {
+        for (uint8_t i = 0; i < n; i++) g_rec_buf[g_rec_len++] = rec[i];
+    } else {
+        return false; // 时间差相对最后一个写入的事件
+    }
+    if ((int32_t)(ev->tick - g_rec_prev_tick) > 0) {
+        g_rec_prev_tick = ev->tick;
+    }
+    return true;
+}
+
+// btn_fifo 读出回调, 在主循环中调用
+static void btn_rec_tap(const btn_event_t *ev)
+{
+    if (!btn_rec_write(ev, BTN_REC_MAX_RECORD)) g_rec_dropped++;
+}
+
+void btn_rec_start(uint32_t now, btn_rec_sink_cb_t sink)
+{
+    g_rec_sink = sink;
+    g_rec_prev_tick = now;
+    g_rec_dropped = 0;
+    g_rec_len = 0;
+    if (sink) {
+        sink(g_rec_header, BTN_REC_HEADER_SIZE);
+    } else {
+        for (uint8_t i = 0; i < BTN_REC_HEADER_SIZE; i++) g_rec_buf[g_rec_len++] = g_rec_header[i];
+    }
+    g_rec_running = true;
+    btn_fifo_set_tap(btn_rec_tap);
+}
+
+void btn_rec_stop(uint32_t now)
+{
+    if (!g_rec_running) return;
+    btn_fifo_set_tap(NULL);
+    g_rec_running = false;
+
+    // 结束标记, 事件不会占用为它保留的空间
+    btn_event_t end;
+    end.btn = BTN_NONE;
+    end.steps = 1;
+    end.tick = now;
+    btn_rec_write(&end, 0);
+}
+
+bool btn_rec_is_running(void)
+{
+    return g_rec_running;
+}
+
+const uint8_t *btn_rec_get_data(uint16_t *len)
+{
+    if (len) *len = g_rec_len;
+    return g_rec_buf;
+}
+
+uint16_t btn_rec_get_dropped(void)
+{
+    return g_rec_dropped;
+}
+
+void btn_rec_dump(btn_rec_print_cb_t print)
+{
+    static const char hex[] = "0123456789abcdef";
+    char line[32 * 2 + 1];
+
+    if (!print) return;
+    print("btn_rec begin %u bytes, %u dropped", (unsigned)g_rec_len, (unsigned)g_rec_dropped);
+    for (uint16_t pos = 0; pos < g_rec_len; pos += 32) {
+        uint8_t n = 0;
+        for (uint16_t i = pos; i < g_rec_len && i < pos + 32; i++) {
+            line[n++] = hex[g_rec_buf[i] >> 4];
+            line[n++] = hex[g_rec_buf[i] & 0x0f];
+        }
+        line[n] = 0;
+        print("%s", line);
+    }
+    print("btn_rec end");
+}
+
+bool btn_rec_reader_init(btn_rec_reader_t *r, const uint8_t *data, uint32_t len,
+                         uint32_t start_tick)
+{
+    r->data = data;
+    r->len = len;
+    r->pos = BTN_REC_HEADER_SIZE;
+    r->tick = start_tick;
+    r->end = false;
+    if (data == NULL || len < BTN_REC_HEADER_SIZE) return false;
+    for (uint8_t i = 0; i < BTN_REC_HEADER_SIZE; i++) {
+        if (data[i] != g_rec_header[i]) return false;
+    }
+    return true;
+}
+
+bool btn_rec_read(btn_rec_reader_t *r, btn_event_t *ev)
+{
+    if (r->end || r->pos >= r->len) return false;
+
+    uint8_t head = r->data[r->pos++];
+    uint32_t delta = 0;
+    uint8_t shift = 0, b;
+    do {
+        if (r->pos >= r->len || shift > 28) return false;
+        b = r->data[r->pos++];
+        delta |= (uint32_t)(b & 0x7f) << shift;
+        shift += 7;
+    } while (b & 0x80);
+
+    ev->btn = (btn_type_t)(head & 0x0f);
+    ev->steps = 1;
+    if (head & BTN_REC_FLAG_STEPS) {
+        if (r->pos >= r->len) return false;
+        ev->steps = r->data[r->pos++];
+    }
+    if (ev->btn >= BTN_MAX) return false;
+
+    r->tick += delta;
+    if (ev->btn == BTN_NONE) {
+        r->end = true;
+        return false;
+    }
+    ev->tick = r->tick;
+    return true;
+}
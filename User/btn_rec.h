@@ -0,0 +1,102 @@
+#ifndef __BTN_REC__
+#define __BTN_REC__
+
+#include "btn_fifo.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// 输入录制: 记录主循环从 btn_fifo 取出的每个事件 (类型、步数、写入时的时间戳),
+// 用于在模拟器中按原时间重放同一段操作, 对比不同编译选项下的帧耗时与总线字节数
+//
+// 数据格式: 3 字节文件头 'B' 'R' BTN_REC_VERSION, 之后每个事件:
+//   1 字节    bit0~3 按键类型, bit4 为 1 时末尾带 1 字节步数
+//   1~5 字节  与上一个事件的时间差 (ms), 每字节低 7 位, bit7 为 1 表示后面还有
+//   0~1 字节  步数 (大于 1 时)
+// 第一个事件的时间差相对 btn_rec_start 的时刻; 按键类型为 BTN_NONE 的记录是结束标记,
+// 时间差为最后一个事件到 btn_rec_stop 的时长, 重放时据此运行到相同的时刻
+
+#define BTN_REC_VERSION 1
+#define BTN_REC_HEADER_SIZE 3
+#define BTN_REC_MAX_RECORD 7 // 单个事件的最大字节数
+
+// 开发板上的录制缓冲区大小 (字节), 写满后丢弃之后的事件, 约 2 字节/事件.
+// 缓冲区是线性的而不是环形: 重放必须从录制开始时的界面状态出发, 覆盖最早的事件后
+// 剩下的记录无法重现; 此外时间差编码依赖前一个事件, 也不能从中间开始读取.
+// 写满后仍保留完整的开头, 丢弃的事件数由 btn_rec_get_dropped 给出
+#ifndef BTN_REC_BUF_SIZE
+#define BTN_REC_BUF_SIZE 512
+#endif
+
+// 输出回调: 录制到文件等外部存储时, 每个事件调用一次 (文件头也通过它写出)
+typedef void (*btn_rec_sink_cb_t)(const uint8_t *data, uint8_t len);
+// 十六进制导出使用的打印回调
+typedef void (*btn_rec_print_cb_t)(const char *fmt, ...);
+
+// 读取录制数据
+typedef struct {
+  const uint8_t *data;
+  uint32_t len;
+  uint32_t pos;
+  uint32_t tick; // 上一个事件的时间戳, 读到结束标记后为录制结束的时刻
+  bool end;      // 已读到结束标记
+} btn_rec_reader_t;
+
+// ========== 录制 ==========
+/**
+ * @brief 开始录制 (注册为 btn_fifo 的读出回调), 会清空之前的录制
+ * @param now 当前时刻, 第一个事件的时间差相对此时刻
+ * @param sink 输出回调, NULL 表示写入 RAM 缓冲区
+ */
+void btn_rec_start(uint32_t now, btn_rec_sink_cb_t sink);
+
+/**
+ * @brief 停止录制并写入结束标记, RAM 缓冲区中的数据保留到下次开始
+ * @param now 当前时刻
+ */
+void btn_rec_stop(uint32_t now);
+
+bool btn_rec_is_running(void);
+
+/**
+ * @brief 获取 RAM 缓冲区中的数据
+ * @param len 数据字节数 (含文件头)
+ * @return 数据起始地址
+ */
+const uint8_t *btn_rec_get_data(uint16_t *len);
+
+/**
+ * @brief 缓冲区已满而丢弃的事件数
+ */
+uint16_t btn_rec_get_dropped(void);
+
+/**
+ * @brief 以十六进制输出 RAM 缓冲区 (每行 32 字节, 前后各一行说明),
+ *        把中间的行保存为文本后可用 xxd -r -p 还原为二进制
+ */
+void btn_rec_dump(btn_rec_print_cb_t print);
+
+// ========== 重放 ==========
+/**
+ * @brief 编码一个事件
+ * @param out 输出, 至少 BTN_REC_MAX_RECORD 字节
+ * @param ev 事件
+ * @param prev_tick 上一个事件的时间戳, 事件早于它时时间差记为 0
+ * @return 写入的字节数
+ */
+uint8_t btn_rec_encode(uint8_t *out, const btn_event_t *ev, uint32_t prev_tick);
+
+/**
+ * @brief 开始读取录制数据
+ * @param start_tick 重放开始的时刻, 事件的时间戳从此累加
+ * @return false-文件头无效
+ */
+bool btn_rec_reader_init(btn_rec_reader_t *r, const uint8_t *data, uint32_t len,
+                         uint32_t start_tick);
+
+/**
+ * @brief 读取下一个事件, 时间戳换算为重放时钟
+ * @return false-已读完 (读到结束标记时 r->end 为 true) 或数据损坏
+ */
+bool btn_rec_read(btn_rec_reader_t *r, btn_event_t *ev);
+
+#endif
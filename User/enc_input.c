@@ -0,0 +1,48 @@
+#include "enc_input.h"
+
+static int32_t g_enc_pending;   // 尚未写入队列的格数, 正数为顺时针
+static uint32_t g_enc_last_emit; // 上次写入事件的时刻
+static bool g_enc_moving;        // 已写入过事件, g_enc_last_emit 有效
+
+void enc_input_init(void)
+{
+    g_enc_pending = 0;
+    g_enc_moving = false;
+}
+
+bool enc_input_update(int16_t detents, uint32_t now)
+{
+    g_enc_pending += detents;
+    if (g_enc_pending == 0) {
+        return false;
+    }
+
+    // 每个周期最多一个事件, 静止后的第一格立即发出
+    uint32_t dt = now - g_enc_last_emit;
+    if (g_enc_moving && dt < ENC_INPUT_PERIOD_MS) {
+        return false;
+    }
+
+    uint32_t count = (uint32_t)(g_enc_pending > 0 ? g_enc_pending : -g_enc_pending);
+    uint32_t gain = 1;
+    if (g_enc_moving && dt < ENC_INPUT_IDLE_MS) {
+        // 转速 (格/秒) = count * 1000 / dt, 按 ENC_INPUT_ACCEL_RATE 分档
+        gain = count * 1000 / (dt * ENC_INPUT_ACCEL_RATE);
+        if (gain < 1) gain = 1;
+        if (gain > ENC_INPUT_ACCEL_MAX) gain = ENC_INPUT_ACCEL_MAX;
+    }
+    uint32_t steps = count * gain;
+
+    btn_event_t ev;
+    ev.btn = g_enc_pending > 0 ? ENC_INPUT_CW_BTN : ENC_INPUT_CCW_BTN;
+    ev.steps = (uint8_t)(steps < 255 ? steps : 255);
+    ev.tick = now;
+    if (!btn_fifo_push_event(BTN_FIFO_LANE_MAIN, &ev)) {
+        return false; // 队列满: 格数留到下次
+    }
+
+    g_enc_pending = 0;
+    g_enc_last_emit = now;
+    g_enc_moving = true;
+    return true;
+}
@@ -0,0 +1,51 @@
+#ifndef __ENC_INPUT__
+#define __ENC_INPUT__
+
+#include "btn_fifo.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// 编码器转换为按键事件: 每个周期最多写入一个多步事件 (btn_event_t.steps),
+// 快速转动时按转速放大步数, 列表与数值一次移动到位, 不再每格占用一帧
+
+// 合并周期 (ms), 与 UI 帧间隔相同时每帧最多一个事件
+#ifndef ENC_INPUT_PERIOD_MS
+#define ENC_INPUT_PERIOD_MS 20
+#endif
+// 加速: 每秒每 ENC_INPUT_ACCEL_RATE 格步数倍率加 1, 低于该转速时每格一步
+#ifndef ENC_INPUT_ACCEL_RATE
+#define ENC_INPUT_ACCEL_RATE 15
+#endif
+// 步数倍率上限
+#ifndef ENC_INPUT_ACCEL_MAX
+#define ENC_INPUT_ACCEL_MAX 8
+#endif
+// 两次转动间隔超过该时间 (ms) 视为从静止开始, 不加速
+#ifndef ENC_INPUT_IDLE_MS
+#define ENC_INPUT_IDLE_MS 200
+#endif
+
+// 顺时针 / 逆时针对应的按键 (列表向下 / 向上)
+#ifndef ENC_INPUT_CW_BTN
+#define ENC_INPUT_CW_BTN BTN_DOWN
+#endif
+#ifndef ENC_INPUT_CCW_BTN
+#define ENC_INPUT_CCW_BTN BTN_UP
+#endif
+
+// ========== 核心接口 ==========
+/**
+ * @brief 初始化, 清除未发出的格数
+ */
+void enc_input_init(void);
+
+/**
+ * @brief 在主循环中调用: 累加新转过的格数, 距上次写入满 ENC_INPUT_PERIOD_MS 时
+ *        写入一个多步事件 (btn_fifo 主循环队列), 队列满时保留到下次
+ * @param detents 自上次调用以来转过的格数, 正数为顺时针 (Encoder_Get)
+ * @param now 当前时刻 (ms)
+ * @return true-本次写入了事件
+ */
+bool enc_input_update(int16_t detents, uint32_t now);
+
+#endif
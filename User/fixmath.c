@@ -0,0 +1,134 @@
+#include "fixmath.h"
+
+#define FIX_LUT_BITS 7
+#define FIX_LUT_SIZE (1 << FIX_LUT_BITS)
+
+// sin(i / 128 * π/2), Q16, i = 128 时为 Q16_ONE
+static const uint16_t fix_sin_lut[FIX_LUT_SIZE] = {
+        0,   804,  1608,  2412,  3216,  4019,  4821,  5623,
+     6424,  7224,  8022,  8820,  9616, 10411, 11204, 11996,
+    12785, 13573, 14359, 15143, 15924, 16703, 17479, 18253,
+    19024, 19792, 20557, 21320, 22078, 22834, 23586, 24335,
+    25080, 25821, 26558, 27291, 28020, 28745, 29466, 30182,
+    30893, 31600, 32303, 33000, 33692, 34380, 35062, 35738,
+    36410, 37076, 37736, 38391, 39040, 39683, 40320, 40951,
+    41576, 42194, 42806, 43412, 44011, 44604, 45190, 45769,
+    46341, 46906, 47464, 48015, 48559, 49095, 49624, 50146,
+    50660, 51166, 51665, 52156, 52639, 53114, 53581, 54040,
+    54491, 54934, 55368, 55794, 56212, 56621, 57022, 57414,
+    57798, 58172, 58538, 58896, 59244, 59583, 59914, 60235,
+    60547, 60851, 61145, 61429, 61705, 61971, 62228, 62476,
+    62714, 62943, 63162, 63372, 63572, 63763, 63944, 64115,
+    64277, 64429, 64571, 64704, 64827, 64940, 65043, 65137,
+    65220, 65294, 65358, 65413, 65457, 65492, 65516, 65531,
+};
+
+// 2^(i / 128) - 1, Q16, i = 128 时为 Q16_ONE
+static const uint16_t fix_exp2_lut[FIX_LUT_SIZE] = {
+        0,   356,   714,  1073,  1435,  1799,  2164,  2532,
+     2902,  3273,  3647,  4022,  4400,  4780,  5162,  5546,
+     5932,  6320,  6710,  7102,  7496,  7893,  8292,  8693,
+     9096,  9501,  9908, 10318, 10730, 11144, 11560, 11979,
+    12400, 12823, 13249, 13676, 14106, 14539, 14974, 15411,
+    15850, 16292, 16737, 17183, 17633, 18084, 18538, 18995,
+    19454, 19915, 20379, 20846, 21315, 21786, 22260, 22737,
+    23216, 23698, 24183, 24670, 25160, 25652, 26148, 26645,
+    27146, 27649, 28155, 28664, 29175, 29690, 30207, 30727,
+    31249, 31775, 32303, 32834, 33369, 33906, 34446, 34988,
+    35534, 36083, 36635, 37190, 37747, 38308, 38872, 39439,
+    40009, 40582, 41158, 41738, 42320, 42906, 43495, 44087,
+    44682, 45280, 45882, 46487, 47095, 47707, 48322, 48940,
+    49562, 50187, 50815, 51447, 52082, 52721, 53363, 54008,
+    54658, 55310, 55966, 56626, 57289, 57956, 58627, 59301,
+    59979, 60661, 61346, 62035, 62727, 63424, 64124, 64828,
+};
+
+static const uint32_t fix_pow10_tab[10] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000,
+};
+
+// 查表并在相邻两项间线性插值, x 为 [0, 1] 的 Q16 小数部分 (16 位)
+static q16_t fix_lut_lerp(const uint16_t *lut, uint32_t x) {
+  uint32_t i = x >> (16 - FIX_LUT_BITS);
+  uint32_t frac = x & ((1UL << (16 - FIX_LUT_BITS)) - 1);
+  if (i >= FIX_LUT_SIZE) return Q16_ONE;
+  int32_t a = lut[i];
+  int32_t b = (i + 1 < FIX_LUT_SIZE) ? lut[i + 1] : Q16_ONE;
+  return a + (((b - a) * (int32_t)frac) >> (16 - FIX_LUT_BITS));
+}
+
+q16_t fix_sin_phase(uint32_t phase) {
+  uint32_t quadrant = phase >> 30;
+  // 象限内的位置, 化为 [0, 1] 的 Q16
+  uint32_t x = (phase & (FIX_PHASE_QUARTER - 1)) >> 14;
+  if (quadrant & 1) x = Q16_ONE - x;
+  q16_t v = fix_lut_lerp(fix_sin_lut, x);
+  return (quadrant & 2) ? -v : v;
+}
+
+q16_t fix_sqrt(q16_t x) {
+  // 逐位开方, 分两轮以免中间结果超出 32 位: 先求整数部分, 再移入 16 位小数
+  uint32_t num = (uint32_t)x;
+  uint32_t res = 0;
+  uint32_t bit = 1UL << 30;
+
+  if (x <= 0) return 0;
+  while (bit > num) bit >>= 2;
+
+  for (uint8_t n = 0; n < 2; n++) {
+    while (bit) {
+      if (num >= res + bit) {
+        num -= res + bit;
+        res = (res >> 1) + bit;
+      } else {
+        res >>= 1;
+      }
+      bit >>= 2;
+    }
+    if (n == 0) {
+      if (num > 65535) {
+        // 余数移位会溢出, 先减去 res 并以 0.5 修正
+        num -= res;
+        num = (num << 16) - 0x8000;
+        res = (res << 16) + 0x8000;
+      } else {
+        num <<= 16;
+        res <<= 16;
+      }
+      bit = 1UL << 14;
+    }
+  }
+  // 四舍五入
+  if (num > res) res++;
+  return (q16_t)res;
+}
+
+uint32_t fix_isqrt(uint32_t x) {
+  uint32_t res = 0;
+  uint32_t bit = 1UL << 30;
+
+  while (bit > x) bit >>= 2;
+  while (bit) {
+    if (x >= res + bit) {
+      x -= res + bit;
+      res = (res >> 1) + bit;
+    } else {
+      res >>= 1;
+    }
+    bit >>= 2;
+  }
+  // 余数大于 res 时 (res + 0.5)^2 < 原值
+  if (x > res) res++;
+  return res;
+}
+
+q16_t fix_exp2(q16_t x) {
+  int32_t n = x >> 16; // 向下取整
+  q16_t m = Q16_ONE + fix_lut_lerp(fix_exp2_lut, (uint32_t)x & 0xffff);
+
+  if (n >= 0) return (n > 14) ? INT32_MAX : (m << n);
+  if (n < -17) return 0;
+  return (m + (1L << (-n - 1))) >> -n;
+}
+
+uint32_t fix_pow10(uint8_t n) { return (n < 10) ? fix_pow10_tab[n] : 0; }
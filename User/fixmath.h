@@ -0,0 +1,96 @@
+#ifndef __FIXMATH_H__
+#define __FIXMATH_H__
+
+#include <stdint.h>
+
+// Q16.16 定点数: 高 16 位整数, 低 16 位小数, 范围约 [-32768, 32768)
+// STM32F103 没有 FPU, 浮点运算全部由软件库完成; 动画插值与三角函数改用整数运算
+typedef int32_t q16_t;
+
+#define Q16_ONE 65536
+#define Q16_HALF 32768
+#define Q16_PI 205887   // π
+#define Q16_PI_2 102944 // π/2
+#define Q16_2PI 411775  // 2π
+// 编译期常量, 如 Q16(0.15); 参数为运行时浮点数时会引入浮点运算
+#define Q16(x) ((q16_t)((x) * 65536.0 + ((x) >= 0 ? 0.5 : -0.5)))
+
+// 相位: 2^32 为一整周, 溢出回绕即取模
+#define FIX_PHASE_QUARTER 0x40000000UL
+
+static inline q16_t fix_from_int(int32_t a) { return (q16_t)((uint32_t)a << 16); }
+
+// 向零取整, 与浮点数强制转换为整数相同
+static inline int32_t fix_to_int(q16_t a) { return a >= 0 ? (a >> 16) : -((-a) >> 16); }
+
+// 四舍五入到整数
+static inline int32_t fix_round(q16_t a) { return fix_to_int(a >= 0 ? a + Q16_HALF : a - Q16_HALF); }
+
+static inline q16_t fix_mul(q16_t a, q16_t b) { return (q16_t)(((int64_t)a * b) >> 16); }
+
+static inline q16_t fix_div(q16_t a, q16_t b) { return (q16_t)(((int64_t)a << 16) / b); }
+
+// a * b 向零取整为整数, 乘积不受 Q16 范围限制 (如行号乘行高)
+static inline int32_t fix_mul_int(q16_t a, int32_t b) {
+  int64_t t = (int64_t)a * b;
+  return (int32_t)(t >= 0 ? (t >> 16) : -((-t) >> 16));
+}
+
+// 整数 a 到 b 之间插值, t 为 [0, 1]
+static inline q16_t fix_lerp_int(int32_t a, int32_t b, q16_t t) {
+  return fix_from_int(a) + (b - a) * t;
+}
+
+// 整数 a 到 b 之间插值后乘以 k, 向下取整为整数; 只对 b - a 做定点运算, a 超出 Q16 范围 (>= 32768) 时仍然正确
+static inline int32_t fix_lerp_scale(int32_t a, int32_t b, q16_t t, int32_t k) {
+  return a * k + (int32_t)(((int64_t)(b - a) * k * t) >> 16);
+}
+
+// 动画进度 elapsed / duration, 限制在 [0, 1]
+static inline q16_t fix_progress(uint32_t elapsed, uint32_t duration) {
+  if (elapsed >= duration) return Q16_ONE;
+  return (q16_t)(((uint64_t)elapsed << 16) / duration);
+}
+
+/**
+ * @brief 正弦/余弦, 相位以 2^32 为一整周 (查表 + 线性插值, 误差约 5e-5)
+ */
+q16_t fix_sin_phase(uint32_t phase);
+static inline q16_t fix_cos_phase(uint32_t phase) { return fix_sin_phase(phase + FIX_PHASE_QUARTER); }
+
+/**
+ * @brief 弧度转为相位
+ */
+static inline uint32_t fix_rad_to_phase(q16_t rad) {
+  // 2^32 / 2π = 683565276 / 2^16
+  return (uint32_t)(((int64_t)rad * 683565276) >> 16);
+}
+
+/**
+ * @brief 正弦/余弦, 参数为弧度
+ */
+static inline q16_t fix_sin(q16_t rad) { return fix_sin_phase(fix_rad_to_phase(rad)); }
+static inline q16_t fix_cos(q16_t rad) { return fix_cos_phase(fix_rad_to_phase(rad)); }
+
+/**
+ * @brief 平方根, 负数返回 0
+ */
+q16_t fix_sqrt(q16_t x);
+
+/**
+ * @brief 32 位整数平方根 (四舍五入). 参数为 Q32 小数时结果即为 Q16,
+ *        适合 [0, 1) 内的自变量, 比 fix_sqrt 多 16 位精度
+ */
+uint32_t fix_isqrt(uint32_t x);
+
+/**
+ * @brief 2 的 x 次幂, x 不超过 14 (结果超出范围时饱和)
+ */
+q16_t fix_exp2(q16_t x);
+
+/**
+ * @brief 10 的 n 次幂 (整数), n 不超过 9
+ */
+uint32_t fix_pow10(uint8_t n);
+
+#endif
@@ -0,0 +1,142 @@
+#include "i2c_dma.h"
+#include <stddef.h>
+
+// stream 驱动的单次传输必须能完整放入一个事务, 否则 BYTE_SEND 只能截断
+#if U8X8_STREAM_I2C_MAX_XFER > I2C_DMA_MAX_XFER
+#error "U8X8_STREAM_I2C_MAX_XFER must not exceed I2C_DMA_MAX_XFER"
+#endif
+
+// 队列中的一个 I2C 事务
+typedef struct {
+  uint16_t offset; // 在数据池中的起始位置
+  uint16_t len;
+  uint8_t addr;
+} i2c_dma_xfer_t;
+
+typedef struct {
+  const i2c_dma_port_t *port;
+  i2c_dma_xfer_t queue[I2C_DMA_QUEUE_LEN];
+  volatile uint8_t head;  // 读指针, 仅在中断中修改
+  volatile uint8_t tail;  // 写指针, 仅在主循环中修改
+  volatile bool running;  // 外设正在传输
+  uint8_t pool[I2C_DMA_POOL_SIZE];
+  uint16_t pool_tail;     // 数据池写位置
+  uint16_t stage_offset;  // 正在组装的事务
+  uint16_t stage_len;
+  i2c_dma_idle_cb_t idle_cb;
+} i2c_dma_t;
+
+static i2c_dma_t g_i2c_dma;
+
+static void i2c_dma_start_head(void) {
+  const i2c_dma_xfer_t *x = &g_i2c_dma.queue[g_i2c_dma.head];
+  g_i2c_dma.port->start(x->addr, g_i2c_dma.pool + x->offset, x->len);
+}
+
+static void i2c_dma_idle(void) {
+  if (g_i2c_dma.port->wait) g_i2c_dma.port->wait();
+}
+
+// 在数据池中预留 I2C_DMA_MAX_XFER 字节的连续空间, 返回起始位置
+// 数据池按环形使用, 仍在队列中的事务占用区间 [队首偏移, pool_tail)
+static uint16_t i2c_dma_reserve(void) {
+  uint16_t head_offset;
+
+  for (;;) {
+    // 队列为空时外设不会再访问数据池, 直接从头开始
+    if (g_i2c_dma.head == g_i2c_dma.tail) {
+      g_i2c_dma.pool_tail = 0;
+      return 0;
+    }
+    if ((uint8_t)(g_i2c_dma.tail + 1) % I2C_DMA_QUEUE_LEN != g_i2c_dma.head) {
+      // 读到的队首可能已过时, 这只会让可用空间偏小
+      head_offset = g_i2c_dma.queue[g_i2c_dma.head].offset;
+      if (g_i2c_dma.pool_tail >= head_offset) {
+        if (g_i2c_dma.pool_tail + I2C_DMA_MAX_XFER <= I2C_DMA_POOL_SIZE)
+          return g_i2c_dma.pool_tail;
+        // 回绕, 严格小于以区分 "满" 与 "空"
+        if (I2C_DMA_MAX_XFER < head_offset) return 0;
+      } else if (g_i2c_dma.pool_tail + I2C_DMA_MAX_XFER < head_offset) {
+        return g_i2c_dma.pool_tail;
+      }
+    }
+    i2c_dma_idle();
+  }
+}
+
+// 将组装好的事务加入队列, 外设空闲时立即启动
+static void i2c_dma_commit(uint8_t addr) {
+  i2c_dma_xfer_t *x;
+
+  if (g_i2c_dma.stage_len == 0) return;
+
+  x = &g_i2c_dma.queue[g_i2c_dma.tail];
+  x->offset = g_i2c_dma.stage_offset;
+  x->len = g_i2c_dma.stage_len;
+  x->addr = addr;
+  g_i2c_dma.pool_tail = g_i2c_dma.stage_offset + g_i2c_dma.stage_len;
+  g_i2c_dma.stage_len = 0;
+
+  // 先移动写指针再检查 running, 中断要么看到新事务, 要么已清除 running
+  g_i2c_dma.tail = (g_i2c_dma.tail + 1) % I2C_DMA_QUEUE_LEN;
+  if (!g_i2c_dma.running) {
+    g_i2c_dma.running = true;
+    i2c_dma_start_head();
+  }
+}
+
+void i2c_dma_init(const i2c_dma_port_t *port) {
+  g_i2c_dma.port = port;
+  g_i2c_dma.head = 0;
+  g_i2c_dma.tail = 0;
+  g_i2c_dma.running = false;
+  g_i2c_dma.pool_tail = 0;
+  g_i2c_dma.stage_offset = 0;
+  g_i2c_dma.stage_len = 0;
+  g_i2c_dma.idle_cb = NULL;
+}
+
+void i2c_dma_on_complete(void) {
+  g_i2c_dma.head = (g_i2c_dma.head + 1) % I2C_DMA_QUEUE_LEN;
+  if (g_i2c_dma.head != g_i2c_dma.tail) {
+    i2c_dma_start_head();
+  } else {
+    g_i2c_dma.running = false;
+    if (g_i2c_dma.idle_cb) g_i2c_dma.idle_cb();
+  }
+}
+
+bool i2c_dma_is_busy(void) { return g_i2c_dma.running; }
+
+void i2c_dma_wait_idle(void) {
+  while (g_i2c_dma.running) i2c_dma_idle();
+}
+
+void i2c_dma_register_idle_cb(i2c_dma_idle_cb_t cb) { g_i2c_dma.idle_cb = cb; }
+
+uint8_t u8x8_byte_i2c_dma(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
+                          void *arg_ptr) {
+  uint8_t *data = (uint8_t *)arg_ptr;
+
+  switch (msg) {
+  case U8X8_MSG_BYTE_SEND:
+    while (arg_int > 0 && g_i2c_dma.stage_len < I2C_DMA_MAX_XFER) {
+      g_i2c_dma.pool[g_i2c_dma.stage_offset + g_i2c_dma.stage_len++] = *data++;
+      arg_int--;
+    }
+    break;
+  case U8X8_MSG_BYTE_INIT:
+  case U8X8_MSG_BYTE_SET_DC:
+    break;
+  case U8X8_MSG_BYTE_START_TRANSFER:
+    g_i2c_dma.stage_offset = i2c_dma_reserve();
+    g_i2c_dma.stage_len = 0;
+    break;
+  case U8X8_MSG_BYTE_END_TRANSFER:
+    i2c_dma_commit(u8x8_GetI2CAddress(u8x8));
+    break;
+  default:
+    return 0;
+  }
+  return 1;
+}
@@ -0,0 +1,59 @@
+#ifndef __I2C_DMA_H__
+#define __I2C_DMA_H__
+
+#include "u8g2.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// ========== 队列配置 ==========
+#define I2C_DMA_QUEUE_LEN 64    // 最多排队的 I2C 事务数
+#define I2C_DMA_POOL_SIZE 1536  // 事务数据池 (一帧 1024 字节 + 地址/控制字节)
+#define I2C_DMA_MAX_XFER 256    // 单个事务最大字节数, 不小于 U8X8_STREAM_I2C_MAX_XFER
+
+// 队列排空(整帧发送完成)回调, 在中断上下文中调用
+typedef void (*i2c_dma_idle_cb_t)(void);
+
+// 外设抽象层: 目标板为 I2C1 + DMA1, 主机端为模拟外设
+typedef struct {
+  // 启动一次传输并立即返回, 完成后由外设调用 i2c_dma_on_complete()
+  // 队列中还有事务时在 i2c_dma_on_complete() 中调用 (中断上下文)
+  void (*start)(uint8_t addr, const uint8_t *data, uint16_t len);
+  // 等待队列空间时反复调用, 可为 NULL
+  void (*wait)(void);
+} i2c_dma_port_t;
+
+// ========== 核心接口 ==========
+/**
+ * @brief 初始化传输引擎
+ * @param port 外设抽象层
+ */
+void i2c_dma_init(const i2c_dma_port_t *port);
+
+/**
+ * @brief 传输完成通知, 由外设在中断中调用
+ */
+void i2c_dma_on_complete(void);
+
+/**
+ * @brief 是否有数据在传输或排队 (帧仍在发送中)
+ * @return true-忙，false-空闲
+ */
+bool i2c_dma_is_busy(void);
+
+/**
+ * @brief 阻塞等待队列排空
+ */
+void i2c_dma_wait_idle(void);
+
+/**
+ * @brief 注册队列排空回调
+ */
+void i2c_dma_register_idle_cb(i2c_dma_idle_cb_t cb);
+
+/**
+ * @brief u8x8 字节层回调, 事务写入队列后立即返回
+ */
+uint8_t u8x8_byte_i2c_dma(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
+                          void *arg_ptr);
+
+#endif
@@ -0,0 +1,83 @@
+#include "key_scan.h"
+
+#if KEY_SCAN_DEBOUNCE_SAMPLES < 1 || KEY_SCAN_DEBOUNCE_SAMPLES > 8
+#error "KEY_SCAN_DEBOUNCE_SAMPLES must be 1 ~ 8"
+#endif
+
+#define KEY_SCAN_MASK ((uint8_t)(0xffu >> (8 - KEY_SCAN_DEBOUNCE_SAMPLES)))
+#define KEY_SCAN_LONG_TICKS ((KEY_SCAN_LONG_MS + KEY_SCAN_PERIOD_MS - 1) / KEY_SCAN_PERIOD_MS)
+
+typedef struct {
+    uint8_t history;   // 最近的采样, bit0 为最新一次, 1 表示按下
+    bool pressed;      // 消抖后的状态
+    bool long_sent;    // 本次按下已触发长按
+    uint16_t hold;     // 按下后经过的采样周期数
+} key_scan_state_t;
+
+static const key_scan_cfg_t *g_key_cfg;
+static uint8_t g_key_num;
+static key_scan_state_t g_key_state[KEY_SCAN_MAX_KEYS];
+
+static void key_scan_emit(btn_type_t btn)
+{
+    if (btn != BTN_NONE) {
+        btn_fifo_push_isr(btn);
+    }
+}
+
+void key_scan_init(const key_scan_cfg_t *cfg, uint8_t num)
+{
+    // 先停止扫描, 防止定时器中断读到未初始化的状态
+    g_key_num = 0;
+    for (uint8_t i = 0; i < KEY_SCAN_MAX_KEYS; i++) {
+        g_key_state[i].history = 0;
+        g_key_state[i].pressed = false;
+        g_key_state[i].long_sent = false;
+        g_key_state[i].hold = 0;
+    }
+    g_key_cfg = cfg;
+    g_key_num = (cfg != NULL) ? (num < KEY_SCAN_MAX_KEYS ? num : KEY_SCAN_MAX_KEYS) : 0;
+}
+
+void key_scan_update(uint32_t pressed)
+{
+    for (uint8_t i = 0; i < g_key_num; i++) {
+        key_scan_state_t *k = &g_key_state[i];
+        const key_scan_cfg_t *cfg = &g_key_cfg[i];
+
+        // 移位寄存器消抖: 最近 KEY_SCAN_DEBOUNCE_SAMPLES 次采样全部相同时才切换状态
+        k->history = (uint8_t)((k->history << 1) | ((pressed >> i) & 1u));
+        uint8_t recent = k->history & KEY_SCAN_MASK;
+
+        if (!k->pressed) {
+            if (recent == KEY_SCAN_MASK) {
+                k->pressed = true;
+                k->long_sent = false;
+                k->hold = 0;
+                key_scan_emit(cfg->press);
+            }
+            continue;
+        }
+
+        if (recent == 0) {
+            k->pressed = false;
+            if (!k->long_sent) key_scan_emit(cfg->release);
+            continue;
+        }
+
+        // 按住计时, 达到阈值后只触发一次长按
+        if (!k->long_sent && ++k->hold >= KEY_SCAN_LONG_TICKS) {
+            k->long_sent = true;
+            key_scan_emit(cfg->long_press);
+        }
+    }
+}
+
+uint32_t key_scan_get_state(void)
+{
+    uint32_t state = 0;
+    for (uint8_t i = 0; i < g_key_num; i++) {
+        if (g_key_state[i].pressed) state |= 1u << i;
+    }
+    return state;
+}
@@ -0,0 +1,52 @@
+#ifndef __KEY_SCAN__
+#define __KEY_SCAN__
+
+#include "btn_fifo.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// 最多扫描的按键数
+#define KEY_SCAN_MAX_KEYS 8
+
+// 采样周期 (ms), key_scan_update 按此周期在定时器中断中调用
+#ifndef KEY_SCAN_PERIOD_MS
+#define KEY_SCAN_PERIOD_MS 2
+#endif
+// 消抖: 连续多少次采样相同才改变按键状态 (1 ~ 8), 默认 5 x 2ms = 10ms
+#ifndef KEY_SCAN_DEBOUNCE_SAMPLES
+#define KEY_SCAN_DEBOUNCE_SAMPLES 5
+#endif
+// 按住多久触发长按 (ms, 从消抖后的按下开始计)
+#ifndef KEY_SCAN_LONG_MS
+#define KEY_SCAN_LONG_MS 800
+#endif
+
+// 单个按键产生的事件, BTN_NONE 表示不产生
+typedef struct {
+  btn_type_t press;      // 按下
+  btn_type_t release;    // 松开 (已触发长按时不产生)
+  btn_type_t long_press; // 按住超过 KEY_SCAN_LONG_MS, 每次按下最多一次
+} key_scan_cfg_t;
+
+// ========== 核心接口 ==========
+/**
+ * @brief 初始化按键扫描, 所有按键视为松开
+ * @param cfg 每个按键的事件配置, 需在扫描期间保持有效
+ * @param num 按键数量, 超过 KEY_SCAN_MAX_KEYS 的部分忽略
+ */
+void key_scan_init(const key_scan_cfg_t *cfg, uint8_t num);
+
+/**
+ * @brief 输入一次采样并推进消抖状态机, 事件写入 btn_fifo 的中断队列, 不阻塞
+ * @param pressed 各按键的原始电平, bit i 为 1 表示第 i 个按键按下
+ */
+void key_scan_update(uint32_t pressed);
+
+/**
+ * @brief 获取消抖后的按键状态
+ * @return bit i 为 1 表示第 i 个按键按下
+ */
+uint32_t key_scan_get_state(void);
+
+#endif
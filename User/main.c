@@ -1,8 +1,14 @@
 #include "Delay.h"
+#include "Encoder.h"
 #include "HList.h"
+#include "Key.h"
 #include "VList.h"
 #include "brick_break.h"
 #include "btn_fifo.h"
+#include "btn_rec.h"
+#include "enc_input.h"
+#include "key_scan.h"
+#include "page_prof.h"
 #include "page_stack.h"
 #include "screen.h"
 #include "splash_log.h"
@@ -16,10 +22,10 @@
 
 extern const uint8_t icon_list[][128];
 
-#define ICON_SETTINGS 0x0081 // ͼ
-#define ICON_ABOUT 0x0114    // ͼ
-#define ICON_LOCK 0x0057     // ͼ
-#define ICON_UNLOCK 0x0078   // Թͼ
+#define ICON_SETTINGS 0x0081 // 设置图标
+#define ICON_ABOUT 0x0114    // 关于图标
+#define ICON_LOCK 0x0057     // 叉叉图标
+#define ICON_UNLOCK 0x0078   // 对勾图标
 
 const Screen_t g_screen_cfg = DEFAULT_SCREEN_CONFIG;
 u8g2_t u8g2;
@@ -27,6 +33,7 @@ hlist_t g_main_hlist;
 vlist_t g_setting_main_menu;
 vlist_t g_setting_sub_menu;
 vlist_t g_about_menu;
+vlist_t g_channel_menu;
 brick_break_ctx_t g_brick_break_ctx;
 
 bool g_wifi_state = false;
@@ -35,19 +42,17 @@ bool g_mute_mode = false;
 float g_screen_brightness = 50.0f;
 float test_num = 0;
 
-// ===================== ԶSplashScreen =====================
+// ===================== 自定义SplashScreen =====================
 static void my_splash_draw(u8g2_t *u8g2, const Screen_t *screen_cfg) {
-  static uint32_t tick_count = 0;
-  tick_count++;
-
-  // 
+  // 电量绘制
   u8g2_SetFont(u8g2, u8g2_font_6x10_tf);
   u8g2_DrawFrame(u8g2, screen_cfg->width - 20, 2, 18, 10);
   u8g2_DrawBox(u8g2, screen_cfg->width - 18, 4, 14, 6);
   u8g2_DrawStr(u8g2, screen_cfg->width - 40, 10, "80%");
 
-  // ʱ
-  uint8_t hour = 12, min = 30, sec = (tick_count / 10) % 60;
+  // 数字时钟
+  uint8_t hour = 12, min = 30, sec = (g_page_stack.main_tick / 1000) % 60;
+  page_stack_request_frame(&g_page_stack);
   char time_str[10];
   sprintf(time_str, "%02d:%02d:%02d", hour, min, sec);
   u8g2_SetFont(u8g2, u8g2_font_logisoso20_tn);
@@ -55,44 +60,59 @@ static void my_splash_draw(u8g2_t *u8g2, const Screen_t *screen_cfg) {
   u8g2_DrawStr(u8g2, (screen_cfg->width - time_width) / 2,
                screen_cfg->height / 2 + 10, time_str);
 
-  // ʾ
+  // 提示文字
   u8g2_SetFont(u8g2, u8g2_font_5x7_tf);
   const char *hint = "Press any btn to enter";
-  u8g2_DrawStr(u8g2, (screen_cfg->width - u8g2_GetStrWidth(u8g2, hint)) / 2,
+  u8g2_DrawStr(u8g2, (screen_cfg->width - str_width_get(u8g2, hint)) / 2,
                screen_cfg->height - 5, hint);
 }
 
-// ===================== ȫְص =====================
+// ===================== 全局按键回调 =====================
 static void global_btn_handler(btn_type_t btn) {
   if (btn == BTN_LONG_PRESS) {
     splash_screen_jump();
   }
 }
 
-// ===================== ԶPage =====================
+// ===================== 自定义Page =====================
 static void osc_app_draw(u8g2_t *u8g2, void *ctx) {
-  static uint8_t wave_offset = 0;
-  wave_offset = (wave_offset + 1) % 255;
+  uint8_t wave_offset = (g_page_stack.main_tick / 20) % 255;
+  page_stack_request_frame(&g_page_stack);
 
   u8g2_SetFont(u8g2, u8g2_font_6x10_tf);
   u8g2_DrawStr(u8g2, 2, 12, "OSCILLOSCOPE");
   u8g2_DrawHLine(u8g2, 0, 15, 128);
 
   for (uint8_t x = 0; x < 128; x++) {
+#if UI_FIXED_MATH
+    uint8_t y = fix_to_int(Q16(40) + fix_sin((x + wave_offset) * Q16(0.15f)) * 15);
+#else
     uint8_t y = 40 + (sin((x + wave_offset) * 0.15f) * 15);
+#endif
     u8g2_DrawPixel(u8g2, x, y);
   }
   u8g2_DrawStr(u8g2, 10, 62, "BACK:Exit  LONG:Home");
 }
-// ԶPage btn Ѻ
+// 自定义Page btn 消费函数
 static void osc_app_input(int btn, void *ctx) {
   if (btn == BTN_BACK) {
     page_stack_pop(&g_page_stack);
   }
 }
-// עԶ
+// 注册自定义组件
 const page_component_t OSC_APP_COMP = {.draw = osc_app_draw,
-                                       .input = osc_app_input};
+                                       .input = osc_app_input,
+                                       .multi_step = false};
+
+// ===================== 虚拟列表 =====================
+#define CHANNEL_NUM 256
+// 通道列表的行在显示时才生成, 不占用 items
+static void channel_provider(void *ctx, uint16_t index, vitem_t *item, char *buf,
+                             uint8_t buf_size) {
+  snprintf(buf, buf_size, "Channel %03u", (unsigned)index);
+  item->title = buf;
+  item->type = VITEM_PLAIN_TEXT;
+}
 
 void my_long_task(void *ctx) {
     Progress_Log(ctx, "Initializing...");
@@ -106,23 +126,25 @@ void my_long_task(void *ctx) {
         Delay_ms(200);
     }
 
-    // ɹ
+    // 成功结束
     //Progress_SetSuccess(ctx);
 	Progress_SetFailed(ctx,"no idea");
 }
 									   
-// ===================== ˵ʼ =====================
+// ===================== 菜单初始化 =====================
 static void ui_menu_init(void) {
-  // ʼб
+  // 初始化列表
   vlist_init(&g_setting_main_menu, &g_page_stack.main_tick);
   vlist_init(&g_setting_sub_menu, &g_page_stack.main_tick);
   vlist_init(&g_about_menu, &g_page_stack.main_tick);
+  vlist_init_provider(&g_channel_menu, &g_page_stack.main_tick, CHANNEL_NUM,
+                      channel_provider, NULL);
   hlist_init(&g_main_hlist, &g_page_stack.main_tick);
 
-  // ʼשϷ
+  // 初始化打砖块游戏
   brick_break_init(&g_brick_break_ctx, &g_page_stack.main_tick, &g_screen_cfg);
 
-  // ò˵
+  // 设置菜单
   vlist_add_toggle(&g_setting_sub_menu, "WIFI Link", &g_wifi_state);
   vlist_add_num(&g_setting_sub_menu, "Brightness", &g_screen_brightness, 0, 100,
                 5);
@@ -139,9 +161,9 @@ static void ui_menu_init(void) {
                               &g_setting_sub_menu, true, "warinng",
                               "Try Again!");
 
-  // OSC
+  // 添加OSC组件入口
   vlist_add_action(&g_setting_main_menu, "Oscilloscope", &OSC_APP_COMP, NULL);
-  // ӴשϷ
+  // 添加打砖块游戏入口
   vlist_add_action(&g_setting_main_menu, "Brick Break", &BRICK_BREAK_COMP,
                    &g_brick_break_ctx);
   vlist_add_protected_action(&g_setting_main_menu, "Brick Break (locked)",
@@ -150,18 +172,19 @@ static void ui_menu_init(void) {
   vlist_add_protected_action(&g_setting_main_menu, "Brick Break (unlocked)",
                              &BRICK_BREAK_COMP, &g_brick_break_ctx, true,
                              "warinng", "This action is locked!");
+  vlist_add_submenu(&g_setting_main_menu, "Channels", &g_channel_menu);
 
-  // ڲ˵
+  // 关于菜单
   vlist_add_plain_text(&g_about_menu, "Version: 0.0.1");
   vlist_add_plain_text(&g_about_menu, "Author: dggdoo");
   vlist_add_plain_text(&g_about_menu, "Build: 2026-01");
 
-  // ˵
+  // 主菜单
   hlist_add_glyph_item(&g_main_hlist, "SETTINGS", ICON_SETTINGS, &VLIST_COMP,
                        &g_setting_main_menu);
   hlist_add_xbm_item(&g_main_hlist, "OSCILLO", icon_list[3], &OSC_APP_COMP,
                      NULL);
-  // ӴשϷ˵
+  // 添加打砖块游戏到主菜单
   hlist_add_glyph_item(&g_main_hlist, "BRICK GAME", ICON_ABOUT,
                        &BRICK_BREAK_COMP, &g_brick_break_ctx);
   hlist_add_glyph_item(&g_main_hlist, "ABOUT", ICON_ABOUT, &VLIST_COMP,
@@ -173,20 +196,99 @@ static void ui_menu_init(void) {
                                  &VLIST_COMP, &g_about_menu, true,
                                  "Try Again!");
 
-  // ʼSplashScreen
+  // 帧分段计时中的组件名
+  page_prof_set_name(&SPLASH_SCREEN_COMP, "splash");
+  page_prof_set_name(&HLIST_COMP, "hlist");
+  page_prof_set_name(&VLIST_COMP, "vlist");
+  page_prof_set_name(&OSC_APP_COMP, "osc");
+  page_prof_set_name(&BRICK_BREAK_COMP, "brick");
+  page_prof_set_name(&PORTAL_MESSAGE_BOX, "msgbox");
+  page_prof_set_name(&PORTAL_NUM, "num");
+  page_prof_set_name(&PORTAL_PRECISE_NUM, "precise");
+
+  // 初始化SplashScreen
   splash_screen_init(&g_main_hlist, my_splash_draw);
-  // עȫְص
+  // 注册全局按键回调
   page_stack_register_global_btn_cb(&g_page_stack, global_btn_handler);
-  // ʼҳ
+  // 初始页面
   splash_screen_jump();
-  // ֱӽHlistҪSplashScreenصɾ
+  // 直接进入Hlist，需要将上面的SplashScreen相关的删除
   // page_stack_push(&g_page_stack, &HLIST_COMP, &g_main_hlist);
 }
 
-// ===================== ڰ =====================
+// ===================== 帧分段计时输出 =====================
+#if PAGE_PROF_ENABLE
+static void prof_print(const char *fmt, ...) {
+  char line[80];
+  va_list args;
+  va_start(args, fmt);
+  vsnprintf(line, sizeof(line), fmt, args);
+  va_end(args);
+  uart_log_printf(__FILE__, __LINE__, "PROF", "%s", line);
+}
+#endif
+
+// ===================== 输入录制 =====================
+// 串口 'c' 开始录制, 再次发送 'c' 停止并以十六进制输出 (btn_rec.h),
+// 保存为二进制后用模拟器 ui_sim -P 按原时间重放
+#ifndef UI_INPUT_REC_ENABLE
+#define UI_INPUT_REC_ENABLE 0
+#endif
+#if UI_INPUT_REC_ENABLE
+// 不加日志前缀, 十六进制行可以直接复制
+static void rec_print(const char *fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  vprintf(fmt, args);
+  va_end(args);
+  printf("\r\n");
+}
+#endif
+
+// ===================== 缓动函数耗时 =====================
+#if UI_FIXED_MATH
+#define EASING_BENCH_CALLS 1024
+// 分别调用缓动函数的浮点与 Q16 版本, 输出每次调用的平均周期数 (DWT_CYCCNT)
+static void easing_bench(const char *name, AHEasingFunction ref, EasingQ16Function fix) {
+  volatile float sum_f = 0;
+  volatile q16_t sum_q = 0;
+  uint32_t t0, c_ref, c_fix;
+
+  t0 = Delay_GetCycle();
+  for (uint16_t i = 0; i < EASING_BENCH_CALLS; i++) sum_f += ref(i * (1.0f / EASING_BENCH_CALLS));
+  c_ref = Delay_GetCycle() - t0;
+
+  t0 = Delay_GetCycle();
+  for (uint16_t i = 0; i < EASING_BENCH_CALLS; i++) sum_q += fix(i * (Q16_ONE / EASING_BENCH_CALLS));
+  c_fix = Delay_GetCycle() - t0;
+
+  uart_debug_printf("%s float:%lu q16:%lu cycles/call\r\n", name,
+                    (unsigned long)(c_ref / EASING_BENCH_CALLS),
+                    (unsigned long)(c_fix / EASING_BENCH_CALLS));
+}
+#endif
+
+// ===================== 板载按键 =====================
+// 旋转编码器 (Encoder.c, PB0/PB1) 与确认键共用 PB1, 启用时 PB1 不作为按键扫描
+#ifndef UI_ENCODER_ENABLE
+#define UI_ENCODER_ENABLE 0
+#endif
+
+// 与 Key.c 中 Key_Pins 的顺序相同; 确认键松开时触发, 按住触发长按 (回到主菜单)
+static const key_scan_cfg_t g_key_cfg[] = {
+#if UI_ENCODER_ENABLE
+    {.press = BTN_NONE, .release = BTN_NONE, .long_press = BTN_NONE}, // PB1 (编码器 B 相)
+#else
+    {.press = BTN_NONE, .release = BTN_ENTER, .long_press = BTN_LONG_PRESS}, // PB1
+#endif
+    {.press = BTN_BACK, .release = BTN_NONE, .long_press = BTN_NONE}, // PB11
+};
+
+// ===================== 串口按键处理 =====================
+// 一次读完已收到的字节 (队列满时留在串口缓冲区), 连续的按键由 page_update 合并后在同一帧显示
 static void uart_btn_process(void) {
-  char ch = uart_dma_read_byte();
-  if (ch != 0) {
+  char ch;
+  while (!btn_fifo_is_full() && (ch = uart_dma_read_byte()) != 0) {
     switch (ch) {
     case 'w':
       btn_fifo_push(BTN_UP);
@@ -209,6 +311,39 @@ static void uart_btn_process(void) {
     case 'r':
       btn_fifo_push(BTN_RIGHT);
       break;
+#if UI_INPUT_REC_ENABLE
+    case 'c':
+      if (btn_rec_is_running()) {
+        btn_rec_stop(Delay_GetTick());
+        btn_rec_dump(rec_print);
+      } else {
+        btn_rec_start(Delay_GetTick(), NULL);
+      }
+      break;
+#endif
+#if PAGE_PROF_ENABLE
+    case 'p':
+      page_prof_dump(prof_print);
+      break;
+#endif
+#if UI_FIXED_MATH
+    case 'e': // 动画热路径上缓动函数的耗时
+      easing_bench("vlist", VLIST_ANIM_FUC, EASING_Q16(VLIST_ANIM_FUC));
+      easing_bench("hlist", HLIST_ICON_ANIM, EASING_Q16(HLIST_ICON_ANIM));
+      easing_bench("portal", QuadraticEaseOut, QuadraticEaseOutQ16);
+      break;
+#endif
+#ifdef U8G2_WITH_GLYPH_CACHE
+    case 'g': { // 字形缓存命中统计, 用于调整 U8G2_GLYPH_CACHE_SIZE
+      u8g2_glyph_cache_stat_t stat;
+      u8g2_GetGlyphCacheStat(&stat);
+      uart_debug_printf("glyph hit:%lu miss:%lu evict:%lu bypass:%lu used:%u/%u\r\n",
+                        (unsigned long)stat.hit, (unsigned long)stat.miss,
+                        (unsigned long)stat.evict, (unsigned long)stat.bypass, stat.used,
+                        U8G2_GLYPH_CACHE_SIZE);
+      break;
+    }
+#endif
     default:
       break;
     }
@@ -217,13 +352,21 @@ static void uart_btn_process(void) {
 }
 
 int main(void) {
-  // Ӳʼ
+  // 硬件初始化
+  Delay_Init();
   uart_init();
   btn_fifo_init();
+  btn_fifo_set_clock(Delay_GetTick);
+  Key_Init();
+  key_scan_init(g_key_cfg, sizeof(g_key_cfg) / sizeof(g_key_cfg[0]));
+#if UI_ENCODER_ENABLE
+  Encoder_Init();
+  enc_input_init();
+#endif
   IIC_Init();
   u8g2Init(&u8g2);
 
-  // һοֱȥ
+  // 这一段可以直接去掉
   splash_log_init(&u8g2, g_screen_cfg.font_height, u8g2_font_5x7_tf);
   splash_log_clear();
   splash_log_printf("splash_log inited");
@@ -239,7 +382,7 @@ int main(void) {
   splash_log_printf("        /Nya!  Powered");
   splash_log_printf("   /|/|        By");
   splash_log_printf("  (- - |       dggduu's");
-  splash_log_printf("   |~\        U8g2 UI");
+  splash_log_printf("   |、~\        U8g2 UI");
   splash_log_printf("  //_,)/       Toolkit");
   Delay_ms(3000);
   splash_log_printf("test_float %.1f", 12.8);
@@ -250,13 +393,19 @@ int main(void) {
   splash_log_printf("ready to test clear");
   Delay_ms(1000);
   splash_log_clear();
-  // Щȥ
+  // 上面这些可以去掉
   page_stack_init(&g_page_stack, &u8g2);
+  page_stack_register_busy_cb(&g_page_stack, IIC_IsBusy);
+  page_stack_register_clock_cb(&g_page_stack, Delay_GetTick);
+  page_prof_init(Delay_GetCycle, SystemCoreClock / 1000000);
   ui_menu_init();
 
   while (1) {
     uart_btn_process();
-    btn_type_t btn = btn_fifo_pop();
+#if UI_ENCODER_ENABLE
+    enc_input_update(Encoder_Get(), Delay_GetTick());
+#endif
+    int btn = btn_fifo_pop_input();
 
     page_update(&g_page_stack, btn);
   }
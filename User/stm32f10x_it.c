@@ -23,6 +23,8 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f10x_it.h"
+#include "Delay.h"
+#include "Key.h"
 
 /** @addtogroup STM32F10x_StdPeriph_Template
   * @{
@@ -134,6 +136,8 @@ void PendSV_Handler(void)
   */
 void SysTick_Handler(void)
 {
+  Delay_IncTick();
+  Key_Tick();
 }
 
 /******************************************************************************/
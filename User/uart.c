@@ -30,7 +30,7 @@ static void uart_dma_process_data(void)
     
     DMA_Cmd(UART_DMA_CHANNEL, DISABLE);
     
-    // λ
+    // 拷贝到环形缓冲区
     for (uint16_t i = 0; i < recv_len; i++) {
         if (((uart_rx_tail + 1) % UART_RX_BUFFER_SIZE) == uart_rx_head) break;
         uart_rx_buf[uart_rx_tail] = uart_dma_buf[i];
@@ -67,7 +67,7 @@ bool uart_init(void)
     USART_InitStruct.USART_Mode = USART_Mode_Tx | USART_Mode_Rx;
     USART_Init(UARTx, &USART_InitStruct);
     
-    // RX DMA
+    // 配置RX DMA
     DMA_DeInit(UART_DMA_CHANNEL);
     DMA_InitStruct.DMA_PeripheralBaseAddr = (uint32_t)&(UARTx->DR);
     DMA_InitStruct.DMA_MemoryBaseAddr = (uint32_t)uart_dma_buf;
@@ -82,12 +82,12 @@ bool uart_init(void)
     DMA_InitStruct.DMA_M2M = DMA_M2M_Disable;
     DMA_Init(UART_DMA_CHANNEL, &DMA_InitStruct);
     
-    // ʹ
+    // 使能外设
     USART_DMACmd(UARTx, USART_DMAReq_Rx, ENABLE);
     DMA_Cmd(UART_DMA_CHANNEL, ENABLE);
     USART_Cmd(UARTx, ENABLE);
     
-    // ʼ
+    // 初始化标记
     uart_dma_init_flag = true;
     uart_dma_clear_buf();
     
@@ -5,6 +5,8 @@
 #include "u8g2.h"
 #include "u8x8.h"
 #include "stm32f10x_i2c.h"
+#include "stm32f10x_dma.h"
+#include "i2c_dma.h"
 
 
 
@@ -14,6 +16,9 @@
 #define IIC_GPIO_Port GPIOB
 
 #define SW_IIC 0
+// 硬件 I2C 使用 DMA 队列发送 (非阻塞), 0 为轮询发送
+#define HW_IIC_DMA 1
+#define IIC_DMA_CHANNEL DMA1_Channel6 // I2C1_TX
 
 void IIC_Init(void) {
 	if (SW_IIC == 1) {
@@ -44,9 +49,102 @@ void IIC_Init(void) {
 		IIC_InitStructure.I2C_OwnAddress1 = 0x00;
 		I2C_Init(I2C1, &IIC_InitStructure);
 		I2C_Cmd(I2C1, ENABLE);
+
+		if (HW_IIC_DMA == 1) {
+			DMA_InitTypeDef DMA_InitStructure;
+			RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+			DMA_DeInit(IIC_DMA_CHANNEL);
+			DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&(I2C1->DR);
+			DMA_InitStructure.DMA_MemoryBaseAddr = 0;
+			DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralDST;
+			DMA_InitStructure.DMA_BufferSize = 1;
+			DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+			DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+			DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+			DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+			DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+			DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+			DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
+			DMA_Init(IIC_DMA_CHANNEL, &DMA_InitStructure);
+			I2C_DMACmd(I2C1, ENABLE);
+
+			NVIC_InitTypeDef NVIC_InitStructure;
+			NVIC_InitStructure.NVIC_IRQChannel = I2C1_EV_IRQn;
+			NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+			NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 2;
+			NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+			NVIC_Init(&NVIC_InitStructure);
+			NVIC_InitStructure.NVIC_IRQChannel = I2C1_ER_IRQn;
+			NVIC_Init(&NVIC_InitStructure);
+		}
+	}
+}
+
+// ===================== I2C1 + DMA 传输端口 =====================
+static volatile uint8_t iic_dma_addr;
+static volatile bool iic_dma_in_isr;  // 正在传输完成中断中
+static volatile bool iic_dma_chained; // 完成中断中已启动下一个事务
+
+// 配置 DMA 后产生起始条件, 后续步骤在 I2C1 事件中断中完成
+static void iic_dma_port_start(uint8_t addr, const uint8_t *data, uint16_t len) {
+	if (iic_dma_in_isr) {
+		// 接续发送: 上一个事务未发送停止条件, 此处产生重复起始条件
+		iic_dma_chained = true;
+	} else {
+		// 队列空闲后的第一个事务: 等待上一次的停止条件发送完成 (约一个 SCL 周期)
+		while (I2C1->CR1 & I2C_CR1_STOP);
+	}
+	iic_dma_addr = addr;
+	DMA_Cmd(IIC_DMA_CHANNEL, DISABLE);
+	IIC_DMA_CHANNEL->CMAR = (uint32_t)data;
+	DMA_SetCurrDataCounter(IIC_DMA_CHANNEL, len);
+	I2C_ITConfig(I2C1, I2C_IT_EVT | I2C_IT_ERR, ENABLE);
+	I2C_GenerateSTART(I2C1, ENABLE);
+}
+
+static const i2c_dma_port_t iic_dma_port = {
+	.start = iic_dma_port_start,
+	.wait = NULL,
+};
+
+// 队列中还有事务时由 i2c_dma_on_complete 直接启动 (重复起始条件),
+// 中断中不再等待停止条件; 队列排空后才发送停止条件
+static void iic_dma_port_finish(void) {
+	DMA_Cmd(IIC_DMA_CHANNEL, DISABLE);
+	iic_dma_chained = false;
+	iic_dma_in_isr = true;
+	i2c_dma_on_complete();
+	iic_dma_in_isr = false;
+	if (!iic_dma_chained) {
+		I2C_ITConfig(I2C1, I2C_IT_EVT | I2C_IT_ERR, DISABLE);
+		I2C_GenerateSTOP(I2C1, ENABLE);
+	}
+}
+
+void I2C1_EV_IRQHandler(void) {
+	if (I2C_GetFlagStatus(I2C1, I2C_FLAG_SB)) {
+		I2C_Send7bitAddress(I2C1, iic_dma_addr, I2C_Direction_Transmitter);
+	} else if (I2C_GetFlagStatus(I2C1, I2C_FLAG_ADDR)) {
+		(void)I2C1->SR2; // 读 SR2 清除 ADDR
+		DMA_Cmd(IIC_DMA_CHANNEL, ENABLE);
+	} else if (I2C_GetFlagStatus(I2C1, I2C_FLAG_BTF) &&
+	           DMA_GetCurrDataCounter(IIC_DMA_CHANNEL) == 0) {
+		// 最后一个字节已移出 (重复起始条件会清除 BTF)
+		iic_dma_port_finish();
 	}
 }
 
+void I2C1_ER_IRQHandler(void) {
+	// 无应答等错误: 丢弃当前事务, 以重复起始条件或停止条件继续发送队列
+	I2C1->SR1 &= ~(I2C_SR1_AF | I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_OVR);
+	iic_dma_port_finish();
+}
+
+bool IIC_IsBusy(void) {
+	if (SW_IIC == 0 && HW_IIC_DMA == 1) return i2c_dma_is_busy();
+	return false;
+}
+
 
 uint8_t u8x8_byte_stm32_hw_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
 {
@@ -164,6 +262,10 @@ uint8_t u8x8_gpio_and_delay(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
 void u8g2Init(u8g2_t *u8g2) {
 	if(SW_IIC == 1) {
 		  u8g2_Setup_ssd1306_i2c_128x64_noname_f(u8g2, U8G2_R0, u8x8_byte_sw_i2c, u8x8_gpio_and_delay);
+	}else if (HW_IIC_DMA == 1) {
+		// 水平寻址连续流, 单次传输不超过 U8X8_STREAM_I2C_MAX_XFER (须 <= I2C_DMA_MAX_XFER)
+		i2c_dma_init(&iic_dma_port);
+		u8g2_Setup_ssd1306_i2c_128x64_stream_f(u8g2, U8G2_R0, u8x8_byte_i2c_dma, u8x8_gpio_and_delay_stm32);
 	}else {
 		u8g2_Setup_ssd1306_i2c_128x64_noname_f(u8g2, U8G2_R0, u8x8_byte_stm32_hw_i2c, u8x8_gpio_and_delay_stm32);
 	}
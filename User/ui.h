@@ -3,7 +3,10 @@
 #define _UI_H_
 
 #include "u8g2.h"
+#include <stdbool.h>
 void IIC_Init(void);
+// 上一帧是否仍在通过 I2C 发送
+bool IIC_IsBusy(void);
 uint8_t u8x8_gpio_and_delay(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
                             void *arg_ptr);
 void u8g2Init(u8g2_t *u8g2);